@@ -0,0 +1,126 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _LIB_LIST_BENCH_H_
+#define _LIB_LIST_BENCH_H_
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+
+/* c -runtime */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+/* frame */
+#include <lib_convention__errno.h>
+
+/* project */
+#include "lib_list.h"
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+
+/* Name of the lock the library is built with, the benchmarks compare the
+ * locks by building with different LIB_LIST_LOCK selections */
+#if defined(CONFIG_LIST__LOCK_TYPE_ATOMIC)
+	#define M_BENCH__LOCK_NAME		"lock_atomic"
+#elif defined(CONFIG_LIST__LOCK_TYPE_CAS)
+	#define M_BENCH__LOCK_NAME		"lock_cas"
+#elif defined(CONFIG_LIST__LOCK_TYPE_FREE)
+	#define M_BENCH__LOCK_NAME		"lock_free"
+#elif defined(CONFIG_LIST__LOCK_TYPE_FUTEX)
+	#define M_BENCH__LOCK_NAME		"lock_futex"
+#elif defined(CONFIG_LIST__LOCK_TYPE_MCS)
+	#define M_BENCH__LOCK_NAME		"lock_mcs"
+#elif defined(CONFIG_LIST__LOCK_TYPE_MEM)
+	#define M_BENCH__LOCK_NAME		"lock_mem"
+#elif defined(CONFIG_LIST__LOCK_TYPE_MTX)
+	#define M_BENCH__LOCK_NAME		"lock_mtx"
+#elif defined(CONFIG_LIST__LOCK_TYPE_TICKET)
+	#define M_BENCH__LOCK_NAME		"lock_ticket"
+#else
+	#define M_BENCH__LOCK_NAME		"unknown"
+#endif
+
+/* Upper bound of the context ids, only some locks limit them */
+#ifdef M_DEV_NUMBER_OF_LOCK_CONTEXT
+	#define M_BENCH__MAX_CONTEXTS	M_DEV_NUMBER_OF_LOCK_CONTEXT
+#else
+	#define M_BENCH__MAX_CONTEXTS	64
+#endif
+
+/* *******************************************************************
+ * Static Inline Functions
+ * ******************************************************************/
+
+static inline uint64_t bench_now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+/* Optional positive integer argument "_idx" of the command line */
+static inline unsigned int bench_arg(int _argc, char *_argv[], int _idx, unsigned int _default)
+{
+	long value;
+
+	if (_argc <= _idx) {
+		return _default;
+	}
+
+	value = strtol(_argv[_idx], NULL, 0);
+	return (value > 0) ? (unsigned int)value : _default;
+}
+
+static inline int bench_cmp_u64(const void *_one, const void *_two)
+{
+	uint64_t one = *(const uint64_t*)_one, two = *(const uint64_t*)_two;
+
+	return (one > two) - (one < two);
+}
+
+/* Sorts "_samples" and prints the median, tail percentiles and maximum */
+static inline void bench_print_latency(const char *_name, uint64_t *_samples, size_t _count)
+{
+	if (_count == 0) {
+		return;
+	}
+
+	qsort(_samples, _count, sizeof(uint64_t), bench_cmp_u64);
+	printf("%-12s %-16s p50 %8llu ns  p99 %8llu ns  p99.9 %8llu ns  max %10llu ns\n",
+			M_BENCH__LOCK_NAME, _name,
+			(unsigned long long)_samples[_count / 2],
+			(unsigned long long)_samples[(_count * 99) / 100],
+			(unsigned long long)_samples[(_count * 999) / 1000],
+			(unsigned long long)_samples[_count - 1]);
+}
+
+#endif /* _LIB_LIST_BENCH_H_ */
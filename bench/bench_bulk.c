@@ -0,0 +1,212 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* Throughput of single node against bulk queue operations of the selected lock
+ *
+ * "threads" contexts move nodes through one shared queue, first with
+ * lib_list__enqueue/lib_list__dequeue per node, then with
+ * lib_list__enqueue_bulk/lib_list__dequeue_bulk in batches of "batch" nodes.
+ * Build with the different LIB_LIST_LOCK selections to compare the locks.
+ *
+ * usage: bench_bulk [threads] [batch] [nodes per thread] */
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+
+/* c -runtime */
+#include <pthread.h>
+
+/* project */
+#include "bench.h"
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+#define M_BENCH__THREADS		1
+#define M_BENCH__BATCH			32
+#define M_BENCH__NODES			2000000
+
+/* *******************************************************************
+ * custom data types (e.g. enumerations, structures, unions)
+ * ******************************************************************/
+struct bench_region {
+	struct queue_attr queue;
+	struct list_node node[];
+};
+
+/* "nodes" holds the nodes a context has dequeued and enqueues next. The
+ * nodes move between the contexts, all of them are in the queue at the start
+ * and the end of a run. */
+struct bench_context {
+	pthread_t thread;
+	uint32_t context_id;
+	int bulk;
+	unsigned int batch;
+	unsigned int count;
+	unsigned int held;
+	struct list_node **nodes;
+};
+
+/* *******************************************************************
+ * static data
+ * ******************************************************************/
+static struct bench_region *s_region;
+static volatile unsigned int s_start;
+
+/* *******************************************************************
+ * static function definitions
+ * ******************************************************************/
+static void bench_single(struct bench_context *_context)
+{
+	unsigned int moved, index;
+
+	for (moved = 0; moved < _context->count; moved += _context->held) {
+		for (index = 0; index < _context->held; index++) {
+			lib_list__enqueue(&s_region->queue, _context->nodes[index], _context->context_id, s_region);
+		}
+		for (_context->held = 0; _context->held < _context->batch; _context->held++) {
+			if (lib_list__dequeue(&s_region->queue, &_context->nodes[_context->held], _context->context_id, s_region) < LIB_LIST__EOK) {
+				break;
+			}
+		}
+	}
+
+	for (index = 0; index < _context->held; index++) {
+		lib_list__enqueue(&s_region->queue, _context->nodes[index], _context->context_id, s_region);
+	}
+	_context->held = 0;
+}
+
+static void bench_bulk(struct bench_context *_context)
+{
+	int ret;
+	unsigned int moved;
+
+	for (moved = 0; moved < _context->count; moved += _context->held) {
+		if (_context->held > 0) {
+			lib_list__enqueue_bulk(&s_region->queue, _context->nodes, _context->held, _context->context_id, s_region);
+		}
+		ret = lib_list__dequeue_bulk(&s_region->queue, _context->nodes, _context->batch, _context->context_id, s_region);
+		_context->held = (ret > 0) ? (unsigned int)ret : 0;
+	}
+
+	if (_context->held > 0) {
+		lib_list__enqueue_bulk(&s_region->queue, _context->nodes, _context->held, _context->context_id, s_region);
+	}
+	_context->held = 0;
+}
+
+static void *bench_worker(void *_arg)
+{
+	struct bench_context *context = (struct bench_context*)_arg;
+
+	while (!__atomic_load_n(&s_start, __ATOMIC_ACQUIRE)) {
+	}
+
+	if (context->bulk) {
+		bench_bulk(context);
+	}
+	else {
+		bench_single(context);
+	}
+	return NULL;
+}
+
+static void bench_run(struct bench_context *_context, unsigned int _threads, int _bulk)
+{
+	unsigned int index;
+	uint64_t start, elapsed;
+	double nodes;
+
+	__atomic_store_n(&s_start, 0, __ATOMIC_RELAXED);
+	for (index = 0; index < _threads; index++) {
+		_context[index].bulk = _bulk;
+		pthread_create(&_context[index].thread, NULL, bench_worker, &_context[index]);
+	}
+
+	start = bench_now_ns();
+	__atomic_store_n(&s_start, 1, __ATOMIC_RELEASE);
+	for (index = 0; index < _threads; index++) {
+		pthread_join(_context[index].thread, NULL);
+	}
+	elapsed = bench_now_ns() - start;
+
+	nodes = (double)_context[0].count * _threads;
+	printf("%-12s %-16s %8.2f ns/node  %8.2f Mnodes/s\n", M_BENCH__LOCK_NAME,
+			_bulk ? "bulk" : "single", (double)elapsed / nodes, nodes * 1000.0 / (double)elapsed);
+}
+
+/* *******************************************************************
+ * Global Functions
+ * ******************************************************************/
+int main(int _argc, char *_argv[])
+{
+	int ret;
+	unsigned int threads, batch, count, index;
+	struct bench_context *context;
+	struct list_node **nodes;
+
+	threads = bench_arg(_argc, _argv, 1, M_BENCH__THREADS);
+	batch = bench_arg(_argc, _argv, 2, M_BENCH__BATCH);
+	count = bench_arg(_argc, _argv, 3, M_BENCH__NODES);
+	if (threads > M_BENCH__MAX_CONTEXTS) {
+		threads = M_BENCH__MAX_CONTEXTS;
+	}
+
+	s_region = calloc(1, sizeof(struct bench_region) + sizeof(struct list_node) * batch * threads);
+	context = calloc(threads, sizeof(struct bench_context));
+	nodes = malloc(sizeof(struct list_node*) * batch * threads);
+	if ((s_region == NULL) || (context == NULL) || (nodes == NULL)) {
+		fprintf(stderr, "out of memory\n");
+		return EXIT_FAILURE;
+	}
+
+	ret = lib_list__init(&s_region->queue, s_region);
+	if (ret < LIB_LIST__EOK) {
+		fprintf(stderr, "lib_list__init failed %i\n", ret);
+		return EXIT_FAILURE;
+	}
+
+	for (index = 0; index < batch * threads; index++) {
+		lib_list__enqueue(&s_region->queue, &s_region->node[index], 0, s_region);
+	}
+
+	for (index = 0; index < threads; index++) {
+		context[index].context_id = index;
+		context[index].batch = batch;
+		context[index].count = count;
+		context[index].nodes = &nodes[index * batch];
+	}
+
+	printf("%u threads, batch %u, %u nodes each\n", threads, batch, count);
+	bench_run(context, threads, 0);
+	bench_run(context, threads, 1);
+
+	free(nodes);
+	free(context);
+	free(s_region);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,267 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* Fork-join workload on work stealing deques against one shared queue
+ *
+ * A binary task tree of "depth" levels is processed by "threads" workers.
+ * Every inner task forks its two children, a leaf spins "work" iterations.
+ * With the deques each worker pushes and pops at its own deque and steals
+ * from the others when it runs empty; the reference run puts all tasks to
+ * one lib_list queue shared by all workers.
+ *
+ * usage: bench_deque [threads] [depth] [work] */
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+
+/* c -runtime */
+#include <pthread.h>
+#include <sched.h>
+
+/* project */
+#include "bench.h"
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+#define M_BENCH__THREADS		4
+#define M_BENCH__DEPTH			18
+#define M_BENCH__WORK			200
+#define M_BENCH__MAX_DEPTH		24
+#define M_BENCH__DEQUE_SIZE		1024
+
+/* *******************************************************************
+ * custom data types (e.g. enumerations, structures, unions)
+ * ******************************************************************/
+
+/* Tasks are numbered like a binary heap, the children of task "n" are
+ * "2n + 1" and "2n + 2" */
+struct bench_task {
+	struct list_node node;
+	uint32_t index;
+	uint32_t depth;
+};
+
+/* The queue and the tasks share one region, the lock-free queue links them
+ * relative to its base */
+struct bench_region {
+	struct queue_attr queue;
+	struct bench_task task[];
+};
+
+struct bench_context {
+	pthread_t thread;
+	uint32_t context_id;
+	int shared;
+	uint64_t steals;
+	struct deque_attr *deque;
+};
+
+/* *******************************************************************
+ * static data
+ * ******************************************************************/
+static struct bench_region *s_region;
+static struct bench_task *s_task;
+static struct bench_context *s_context;
+static unsigned int s_threads;
+static unsigned int s_work;
+static volatile uint32_t s_done;
+static uint32_t s_total;
+static volatile unsigned int s_start;
+
+/* *******************************************************************
+ * static function definitions
+ * ******************************************************************/
+static void bench_execute(struct bench_context *_context, struct bench_task *_task);
+
+static void bench_leaf(void)
+{
+	volatile unsigned int count;
+
+	for (count = 0; count < s_work; count++) {
+	}
+}
+
+static void bench_fork(struct bench_context *_context, struct bench_task *_task)
+{
+	int ret;
+
+	if (_context->shared) {
+		ret = lib_list__enqueue(&s_region->queue, &_task->node, _context->context_id, s_region);
+	}
+	else {
+		ret = lib_list__deque_push(_context->deque, &_task->node, s_region);
+	}
+
+	/* A full deque runs the task inline */
+	if (ret < LIB_LIST__EOK) {
+		bench_execute(_context, _task);
+	}
+}
+
+static void bench_execute(struct bench_context *_context, struct bench_task *_task)
+{
+	uint32_t child;
+
+	if (_task->depth == 0) {
+		bench_leaf();
+	}
+	else {
+		for (child = 2 * _task->index + 1; child <= 2 * _task->index + 2; child++) {
+			s_task[child].index = child;
+			s_task[child].depth = _task->depth - 1;
+			bench_fork(_context, &s_task[child]);
+		}
+	}
+	__atomic_add_fetch(&s_done, 1, __ATOMIC_RELAXED);
+}
+
+static int bench_take(struct bench_context *_context, struct list_node **_node)
+{
+	unsigned int victim;
+
+	if (_context->shared) {
+		return lib_list__dequeue(&s_region->queue, _node, _context->context_id, s_region);
+	}
+
+	if (lib_list__deque_pop(_context->deque, _node, s_region) == LIB_LIST__EOK) {
+		return LIB_LIST__EOK;
+	}
+
+	for (victim = 1; victim < s_threads; victim++) {
+		if (lib_list__deque_steal(s_context[(_context->context_id + victim) % s_threads].deque, _node, s_region) == LIB_LIST__EOK) {
+			_context->steals++;
+			return LIB_LIST__EOK;
+		}
+	}
+	return -LIB_LIST__ESTD_AGAIN;
+}
+
+static void *bench_worker(void *_arg)
+{
+	struct list_node *node;
+	struct bench_context *context = (struct bench_context*)_arg;
+
+	while (!__atomic_load_n(&s_start, __ATOMIC_ACQUIRE)) {
+	}
+
+	while (__atomic_load_n(&s_done, __ATOMIC_RELAXED) < s_total) {
+		if (bench_take(context, &node) == LIB_LIST__EOK) {
+			bench_execute(context, (struct bench_task*)node);
+		}
+		else {
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static void bench_run(unsigned int _depth, int _shared)
+{
+	unsigned int index;
+	uint64_t start, elapsed, steals = 0;
+
+	s_done = 0;
+	__atomic_store_n(&s_start, 0, __ATOMIC_RELAXED);
+	for (index = 0; index < s_threads; index++) {
+		s_context[index].shared = _shared;
+		s_context[index].steals = 0;
+		lib_list__deque_init(s_context[index].deque, M_BENCH__DEQUE_SIZE);
+		pthread_create(&s_context[index].thread, NULL, bench_worker, &s_context[index]);
+	}
+
+	/* The root task is forked by the first worker */
+	s_task[0].index = 0;
+	s_task[0].depth = _depth;
+	bench_fork(&s_context[0], &s_task[0]);
+
+	start = bench_now_ns();
+	__atomic_store_n(&s_start, 1, __ATOMIC_RELEASE);
+	for (index = 0; index < s_threads; index++) {
+		pthread_join(s_context[index].thread, NULL);
+		steals += s_context[index].steals;
+	}
+	elapsed = bench_now_ns() - start;
+
+	printf("%-12s %-16s %8.2f ns/task  %8.2f Mtasks/s  %llu steals\n", M_BENCH__LOCK_NAME,
+			_shared ? "shared queue" : "deque", (double)elapsed / s_total,
+			(double)s_total * 1000.0 / (double)elapsed, (unsigned long long)steals);
+}
+
+/* *******************************************************************
+ * Global Functions
+ * ******************************************************************/
+int main(int _argc, char *_argv[])
+{
+	int ret, size;
+	unsigned int depth, index;
+
+	s_threads = bench_arg(_argc, _argv, 1, M_BENCH__THREADS);
+	depth = bench_arg(_argc, _argv, 2, M_BENCH__DEPTH);
+	s_work = bench_arg(_argc, _argv, 3, M_BENCH__WORK);
+	if (s_threads > M_BENCH__MAX_CONTEXTS) {
+		s_threads = M_BENCH__MAX_CONTEXTS;
+	}
+	if (depth > M_BENCH__MAX_DEPTH) {
+		depth = M_BENCH__MAX_DEPTH;
+	}
+
+	s_total = (UINT32_C(2) << depth) - 1;
+	size = lib_list__deque_calc_size(M_BENCH__DEQUE_SIZE);
+	s_region = calloc(1, sizeof(struct bench_region) + sizeof(struct bench_task) * s_total);
+	s_context = calloc(s_threads, sizeof(struct bench_context));
+	if ((s_region == NULL) || (s_context == NULL) || (size < 0)) {
+		fprintf(stderr, "out of memory\n");
+		return EXIT_FAILURE;
+	}
+
+	for (index = 0; index < s_threads; index++) {
+		s_context[index].context_id = index;
+		s_context[index].deque = malloc((size_t)size);
+		if (s_context[index].deque == NULL) {
+			fprintf(stderr, "out of memory\n");
+			return EXIT_FAILURE;
+		}
+	}
+
+	s_task = s_region->task;
+	ret = lib_list__init(&s_region->queue, s_region);
+	if (ret < LIB_LIST__EOK) {
+		fprintf(stderr, "lib_list__init failed %i\n", ret);
+		return EXIT_FAILURE;
+	}
+
+	printf("%u threads, depth %u (%u tasks), work %u\n", s_threads, depth, s_total, s_work);
+	bench_run(depth, 0);
+	bench_run(depth, 1);
+
+	for (index = 0; index < s_threads; index++) {
+		free(s_context[index].deque);
+	}
+	free(s_context);
+	free(s_region);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,159 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* Latency of contended queue operations of the selected lock
+ *
+ * "threads" contexts enqueue and dequeue on one shared queue. The time of
+ * every call is sampled, so the percentiles cover the wait for the lock and
+ * the time it is held. The fairness of a lock shows up in the ratio of
+ * p99.9 to p50; build with LIB_LIST_LOCK=lock_ticket, lock_cas and lock_mtx
+ * to compare them.
+ *
+ * usage: bench_lock_latency [threads] [iterations per thread] */
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+
+/* c -runtime */
+#include <pthread.h>
+
+/* project */
+#include "bench.h"
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+#define M_BENCH__THREADS		4
+#define M_BENCH__ITERATIONS		200000
+#define M_BENCH__NODES			64
+
+/* *******************************************************************
+ * custom data types (e.g. enumerations, structures, unions)
+ * ******************************************************************/
+struct bench_region {
+	struct queue_attr queue;
+	struct list_node node[];
+};
+
+struct bench_context {
+	pthread_t thread;
+	uint32_t context_id;
+	unsigned int iterations;
+	struct list_node *node;
+	uint64_t *enqueue_ns;
+	uint64_t *dequeue_ns;
+};
+
+/* *******************************************************************
+ * static data
+ * ******************************************************************/
+static struct bench_region *s_region;
+static volatile unsigned int s_start;
+
+/* *******************************************************************
+ * static function definitions
+ * ******************************************************************/
+static void *bench_worker(void *_arg)
+{
+	unsigned int count;
+	uint64_t start;
+	struct list_node *node;
+	struct bench_context *context = (struct bench_context*)_arg;
+
+	while (!__atomic_load_n(&s_start, __ATOMIC_ACQUIRE)) {
+	}
+
+	for (count = 0; count < context->iterations; count++) {
+		node = &context->node[count % M_BENCH__NODES];
+
+		start = bench_now_ns();
+		lib_list__enqueue(&s_region->queue, node, context->context_id, s_region);
+		context->enqueue_ns[count] = bench_now_ns() - start;
+
+		start = bench_now_ns();
+		lib_list__dequeue(&s_region->queue, &node, context->context_id, s_region);
+		context->dequeue_ns[count] = bench_now_ns() - start;
+	}
+	return NULL;
+}
+
+/* *******************************************************************
+ * Global Functions
+ * ******************************************************************/
+int main(int _argc, char *_argv[])
+{
+	int ret;
+	unsigned int threads, iterations, index;
+	size_t samples;
+	uint64_t *enqueue_ns, *dequeue_ns;
+	struct bench_context *context;
+
+	threads = bench_arg(_argc, _argv, 1, M_BENCH__THREADS);
+	iterations = bench_arg(_argc, _argv, 2, M_BENCH__ITERATIONS);
+	if (threads > M_BENCH__MAX_CONTEXTS) {
+		threads = M_BENCH__MAX_CONTEXTS;
+	}
+
+	samples = (size_t)threads * iterations;
+	s_region = calloc(1, sizeof(struct bench_region) + sizeof(struct list_node) * M_BENCH__NODES * threads);
+	context = calloc(threads, sizeof(struct bench_context));
+	enqueue_ns = malloc(samples * sizeof(uint64_t));
+	dequeue_ns = malloc(samples * sizeof(uint64_t));
+	if ((s_region == NULL) || (context == NULL) || (enqueue_ns == NULL) || (dequeue_ns == NULL)) {
+		fprintf(stderr, "out of memory\n");
+		return EXIT_FAILURE;
+	}
+
+	ret = lib_list__init(&s_region->queue, s_region);
+	if (ret < LIB_LIST__EOK) {
+		fprintf(stderr, "lib_list__init failed %i\n", ret);
+		return EXIT_FAILURE;
+	}
+
+	for (index = 0; index < threads; index++) {
+		context[index].context_id = index;
+		context[index].iterations = iterations;
+		context[index].node = &s_region->node[index * M_BENCH__NODES];
+		context[index].enqueue_ns = &enqueue_ns[(size_t)index * iterations];
+		context[index].dequeue_ns = &dequeue_ns[(size_t)index * iterations];
+		pthread_create(&context[index].thread, NULL, bench_worker, &context[index]);
+	}
+
+	__atomic_store_n(&s_start, 1, __ATOMIC_RELEASE);
+	for (index = 0; index < threads; index++) {
+		pthread_join(context[index].thread, NULL);
+	}
+
+	printf("%u threads, %u iterations each\n", threads, iterations);
+	bench_print_latency("enqueue", enqueue_ns, samples);
+	bench_print_latency("dequeue", dequeue_ns, samples);
+
+	free(dequeue_ns);
+	free(enqueue_ns);
+	free(context);
+	free(s_region);
+	return EXIT_SUCCESS;
+}
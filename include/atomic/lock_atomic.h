@@ -0,0 +1,192 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef SH_LOCK_ATOMIC_H_
+#define SH_LOCK_ATOMIC_H_
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+
+/* system */
+#include <sched.h>
+
+/* own libs */
+#include <lib_convention__errno.h>
+
+/* project */
+#include "lib_list_types.h"
+#include "lock_atomic_types.h"
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+
+/* Relax iterations after which the waiting context yields the processor */
+#ifndef M_LOCK_ATOMIC__SPIN_COUNT
+	#define M_LOCK_ATOMIC__SPIN_COUNT		10000
+#endif
+
+/* Upper bound of the exponential backoff after a lost CAS, in relax iterations */
+#ifndef M_LOCK_ATOMIC__BACKOFF_MAX
+	#define M_LOCK_ATOMIC__BACKOFF_MAX		1024
+#endif
+
+/* *******************************************************************
+ * Static Inline Functions
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a semilock object - Based on atomic builtins
+ *
+ * The lock word records the context id of the holder. Entering a free lock
+ * takes a single CAS independent of the number of contexts, waiters poll the
+ * word read-only and back off exponentially after a lost CAS. Acquire and
+ * release ordering makes the lock correct on weakly ordered hardware.
+ *
+ * \param	*_lock [out]		The semilock_t data type will be initialized
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * ****************************************************************************/
+static inline int atomiclock__init(semilock_t *_lock)
+{
+	if(_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	__atomic_store_n(&_lock->owner, 0, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Lock of the semilock object - Based on atomic builtins
+ *
+ *	The contexed_id's are sequential number defined between the range of
+ *		(0 <= _context_id < M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to check if section
+ *							is already entered
+ *			_context_id		Sequential number of the calling context
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * ****************************************************************************/
+static inline int atomiclock__lock(semilock_t *_lock, uint32_t _context_id)
+{
+	uint32_t expected, spin = 0, backoff = 1, delay;
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	/*Check if the passed context ID is greater than the number of defined contexts */
+	if(_context_id >= M_DEV_NUMBER_OF_LOCK_CONTEXT) {
+		return -LIB_LIST__ESTD_FAULT;
+	}
+
+	while (1) {
+		expected = 0;
+		if (__atomic_compare_exchange_n(&_lock->owner, &expected, _context_id + 1, 1, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+			return LIB_LIST__EOK;
+		}
+
+		for (delay = backoff; delay > 0; delay--) {
+			M_LIB_LIST__RELAX();
+		}
+		spin += backoff;
+		if (backoff < M_LOCK_ATOMIC__BACKOFF_MAX) {
+			backoff <<= 1;
+		}
+
+		while (__atomic_load_n(&_lock->owner, __ATOMIC_RELAXED) != 0) {
+			M_LIB_LIST__RELAX();
+			if (++spin >= M_LOCK_ATOMIC__SPIN_COUNT) {
+				spin = 0;
+				sched_yield();
+			}
+		}
+	}
+}
+
+/* ************************************************************************//**
+ * \brief	Unlock of the semilock object - Based on atomic builtins
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to signalizes that a section
+ * 							is left
+ *			_context_id		Sequential number of the calling context
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_ACCES		: The lock is not held by "_context_id"
+ * ****************************************************************************/
+static inline int atomiclock__unlock(semilock_t *_lock, uint32_t _context_id)
+{
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (__atomic_load_n(&_lock->owner, __ATOMIC_RELAXED) != (_context_id + 1)) {
+		return -LIB_LIST__ESTD_ACCES;
+	}
+
+	__atomic_store_n(&_lock->owner, 0, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Trylock of the semilock object - Based on atomic builtins
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to check if section
+ * 							is already entered
+ *			_context_id		Sequential number of the calling context
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_BUSY		: Critical section is already entered by other context
+ * ****************************************************************************/
+static inline int atomiclock__trylock(semilock_t *_lock, uint32_t _context_id)
+{
+	uint32_t expected = 0;
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	/*Check if the passed context ID is greater than the number of defined contexts */
+	if(_context_id >= M_DEV_NUMBER_OF_LOCK_CONTEXT) {
+		return -LIB_LIST__ESTD_FAULT;
+	}
+
+	if (__atomic_compare_exchange_n(&_lock->owner, &expected, _context_id + 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+		return LIB_LIST__EOK;
+	}
+	return -LIB_LIST__ESTD_BUSY;
+}
+
+#endif /* SH_LOCK_ATOMIC_H_ */
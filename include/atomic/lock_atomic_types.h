@@ -0,0 +1,62 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef	_LOCK_ATOMIC_TYPES_H_
+#define _LOCK_ATOMIC_TYPES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+#include <stdint.h>
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+#ifndef M_DEV_NUMBER_OF_LOCK_CONTEXT
+	#define M_DEV_NUMBER_OF_LOCK_CONTEXT		64
+#endif
+
+/* *******************************************************************
+ * custom data types (e.g. enumerations, structures, unions)
+ * ******************************************************************/
+
+/* Lock word, the context id + 1 of the holder or zero if the lock is free.
+ * It holds no addresses and can be placed in shared memory. It is only
+ * accessed by the __atomic builtins, so the type stays usable from C++. */
+struct semilock {
+	volatile uint32_t owner;
+};
+
+typedef struct semilock semilock_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LOCK_ATOMIC_TYPES_H_ */
@@ -32,13 +32,41 @@
 
 /* system */
 #include <pthread.h>
+#include <sched.h>
 
 /* own libs */
 #include <lib_convention__errno.h>
 
 /* project */
+#include "lib_list_types.h"
 #include "lock_cas_types.h"
 
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+
+/* Relax iterations after which the waiting context yields the processor */
+#ifndef M_LOCK_CAS__SPIN_COUNT
+	#define M_LOCK_CAS__SPIN_COUNT			10000
+#endif
+
+/* Window of the randomized exponential backoff after a lost CAS, in relax
+ * iterations. Both values have to be powers of two. */
+#ifndef M_LOCK_CAS__BACKOFF_MIN
+	#define M_LOCK_CAS__BACKOFF_MIN			4
+#endif
+#ifndef M_LOCK_CAS__BACKOFF_MAX
+	#define M_LOCK_CAS__BACKOFF_MAX			1024
+#endif
+
+/* *******************************************************************
+ * Static Variables
+ * ******************************************************************/
+
+/* State of the backoff generator of the calling thread, it advances with
+ * every lost CAS so consecutive calls and threads draw different delays */
+static __thread uint32_t s_spinlock_seed;
+
 /* *******************************************************************
  * Static Inline Functions
  * ******************************************************************/
@@ -71,21 +99,46 @@ static inline int spinlock__init(semilock_t *_lock)
 /* ************************************************************************//**
  * \brief	Lock of the semilock object - Based on CAS
  *
+ * Test and test and set: the lock word is polled with plain loads, which
+ * keep the cache line shared, and the CAS is only tried once it reads free.
+ * After a lost CAS the context backs off for a random number of relax
+ * iterations, the window doubles with every further loss. The processor is
+ * yielded every M_LOCK_CAS__SPIN_COUNT relax iterations.
+ *
  * \param	*_lock [in]	 	The semilock_t data type to check if section
  * 							is already entered
  * \return 	EOK
  * ****************************************************************************/
 static inline int spinlock__lock(semilock_t *_lock)
 {
-    while (1) {
-        int i;
-        for (i=0; i < 10000; i++) {
-            if (__sync_bool_compare_and_swap(_lock, 0, 1)) {
-            	return LIB_LIST__EOK;
-            }
-        }
-        sched_yield();
-    }
+	uint32_t spin = 0, backoff = M_LOCK_CAS__BACKOFF_MIN, delay;
+
+	while (1) {
+		while (__atomic_load_n(_lock, __ATOMIC_RELAXED) != 0) {
+			M_LIB_LIST__RELAX();
+			if (++spin >= M_LOCK_CAS__SPIN_COUNT) {
+				spin = 0;
+				sched_yield();
+			}
+		}
+
+		if (__sync_bool_compare_and_swap(_lock, 0, 1)) {
+			return LIB_LIST__EOK;
+		}
+
+		/* The thread local address differs per thread, it seeds the first draw */
+		if (s_spinlock_seed == 0) {
+			s_spinlock_seed = (uint32_t)(uintptr_t)&s_spinlock_seed;
+		}
+		s_spinlock_seed = s_spinlock_seed * 1103515245 + 12345;
+		for (delay = ((s_spinlock_seed >> 16) & (backoff - 1)) + 1; delay > 0; delay--) {
+			M_LIB_LIST__RELAX();
+			spin++;
+		}
+		if (backoff < M_LOCK_CAS__BACKOFF_MAX) {
+			backoff <<= 1;
+		}
+	}
 }
 
 /* ************************************************************************//**
@@ -96,8 +149,7 @@ static inline int spinlock__lock(semilock_t *_lock)
  * \return 	EOK
  * ****************************************************************************/
 static inline int spinlock__unlock(semilock_t *_lock) {
-    __asm__ __volatile__ ("" ::: "memory");
-    *_lock = 0;
+    __atomic_store_n(_lock, 0, __ATOMIC_RELEASE);
     return EOK;
 }
 
@@ -111,7 +163,7 @@ static inline int spinlock__unlock(semilock_t *_lock) {
  * 			-ESTD_BUSY		Critical section is already entered by other context
  * ****************************************************************************/
 static inline int spinlock__trylock(semilock_t *_lock) {
-    if (__sync_bool_compare_and_swap(_lock, 0, 1)) {
+    if ((__atomic_load_n(_lock, __ATOMIC_RELAXED) == 0) && __sync_bool_compare_and_swap(_lock, 0, 1)) {
         return EOK;
     }
     return -ESTD_BUSY;
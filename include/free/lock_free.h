@@ -0,0 +1,171 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _LOCK_FREE_H_
+#define _LOCK_FREE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+
+/* c-runtime */
+#include <string.h>
+#include <stdint.h>
+#include <sched.h>
+
+/* own libs */
+#include <lib_convention__errno.h>
+
+/* project */
+#include "lib_list_types.h"
+#include "lock_free_types.h"
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+#if (UINTPTR_MAX != 0xFFFFFFFFFFFFFFFFu)
+	#error "lock_free requires a 64 bit target to store tagged offsets"
+#endif
+
+/* A tagged word holds a 48 bit base relative offset and a 16 bit modification
+ * counter. The counter is incremented at every successful swap, so a stale
+ * compare-and-swap of a recycled node (ABA) fails */
+#define M_LOCKFREE_TAG_SHIFT		48
+#define M_LOCKFREE_OFFSET_MASK		((UINT64_C(1) << M_LOCKFREE_TAG_SHIFT) - 1)
+#define M_LOCKFREE_NIL				M_LOCKFREE_OFFSET_MASK
+
+/* *******************************************************************
+ * Static Inline Functions
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of the lock-free queue state
+ *
+ * The queue words are cleared, the queue handling itself sets up the
+ * head/tail offsets afterwards. The embedded "spin" lock is released.
+ *
+ * \param	*_lock [out]		The semilock_t data type will be initialized
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * ****************************************************************************/
+static inline int lockfree__init(semilock_t *_lock)
+{
+	if(_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	memset((void*)_lock, 0, sizeof(semilock_t));
+	__sync_synchronize();
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Lock of the embedded spin lock
+ *
+ * Only used for resources without a lock-free implementation (e.g. the
+ * pool allocator). The queue enqueue/dequeue paths never take it.
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to check if section
+ * 							is already entered
+ * \return 	EOK
+ * ****************************************************************************/
+static inline int lockfree__lock(semilock_t *_lock)
+{
+	while (1) {
+		int i;
+		for (i=0; i < 10000; i++) {
+			if (__sync_bool_compare_and_swap(&_lock->spin, 0, 1)) {
+				return LIB_LIST__EOK;
+			}
+			M_LIB_LIST__RELAX();
+		}
+		sched_yield();
+	}
+}
+
+/* ************************************************************************//**
+ * \brief	Unlock of the embedded spin lock
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to signalizes that a section
+ * 							is left
+ * \return 	EOK
+ * ****************************************************************************/
+static inline int lockfree__unlock(semilock_t *_lock)
+{
+	__sync_lock_release(&_lock->spin);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Compose a tagged word of offset and modification counter
+ * ****************************************************************************/
+static inline uint64_t lockfree__tag_make(uint64_t _offset, uint64_t _count)
+{
+	return (_count << M_LOCKFREE_TAG_SHIFT) | (_offset & M_LOCKFREE_OFFSET_MASK);
+}
+
+/* ************************************************************************//**
+ * \brief	Offset part of a tagged word
+ * ****************************************************************************/
+static inline uint64_t lockfree__tag_offset(uint64_t _tagged)
+{
+	return _tagged & M_LOCKFREE_OFFSET_MASK;
+}
+
+/* ************************************************************************//**
+ * \brief	Modification counter part of a tagged word
+ * ****************************************************************************/
+static inline uint64_t lockfree__tag_count(uint64_t _tagged)
+{
+	return _tagged >> M_LOCKFREE_TAG_SHIFT;
+}
+
+/* ************************************************************************//**
+ * \brief	Acquire load of a tagged word
+ * ****************************************************************************/
+static inline uint64_t lockfree__load(volatile uint64_t *_word)
+{
+	return __atomic_load_n(_word, __ATOMIC_ACQUIRE);
+}
+
+/* ************************************************************************//**
+ * \brief	Compare and swap of a tagged word (full barrier)
+ *
+ * \return 	"1" if the word was replaced, "0" if it was modified meanwhile
+ * ****************************************************************************/
+static inline int lockfree__cas(volatile uint64_t *_word, uint64_t _old, uint64_t _new)
+{
+	return __sync_bool_compare_and_swap(_word, _old, _new) ? 1 : 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LOCK_FREE_H_ */
@@ -0,0 +1,280 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef SH_LOCK_FUTEX_H_
+#define SH_LOCK_FUTEX_H_
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+
+/* system */
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/* own libs */
+#include <lib_convention__errno.h>
+
+/* project */
+#include "lib_list_types.h"
+#include "lock_futex_types.h"
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+
+/* Attempts to take the lock by spinning before the context sleeps */
+#ifndef M_LOCK_FUTEX__SPIN_COUNT
+	#define M_LOCK_FUTEX__SPIN_COUNT		100
+#endif
+
+/* Interval in ms in which a sleeping context checks if the holder is alive */
+#ifndef M_LOCK_FUTEX__OWNER_CHECK_MS
+	#define M_LOCK_FUTEX__OWNER_CHECK_MS	100
+#endif
+
+/* *******************************************************************
+ * Static Variables
+ * ******************************************************************/
+
+/* Thread id of the calling thread, reset in the child after a fork */
+static __thread uint32_t s_futexlock_tid;
+static pthread_once_t s_futexlock_once = PTHREAD_ONCE_INIT;
+
+/* *******************************************************************
+ * Static Inline Functions
+ * ******************************************************************/
+static inline void futexlock_atfork_child(void)
+{
+	s_futexlock_tid = 0;
+}
+
+static inline void futexlock_register_atfork(void)
+{
+	pthread_atfork(NULL, NULL, futexlock_atfork_child);
+}
+
+static inline uint32_t futexlock_tid(void)
+{
+	if (s_futexlock_tid == 0) {
+		pthread_once(&s_futexlock_once, futexlock_register_atfork);
+		s_futexlock_tid = (uint32_t)syscall(SYS_gettid);
+	}
+	return s_futexlock_tid;
+}
+
+/* A holder is dead if its thread id does not exist anymore or belongs to a
+ * zombie, i.e. a terminated process not yet reaped by its parent. Thread ids
+ * are only comparable inside of one pid namespace. The lock word holds no
+ * more than the thread id: once the kernel hands the id of a dead holder to
+ * a new thread, the holder is taken as alive and the lock is not recovered.
+ * Linux hands out ids cyclically up to pid_max, which makes an early reuse
+ * unlikely but does not rule it out. */
+static inline int futexlock_owner_dead(uint32_t _word)
+{
+	int fd;
+	ssize_t len;
+	char buf[128], *state;
+	pid_t tid = (pid_t)(_word & FUTEX_TID_MASK);
+
+	if (kill(tid, 0) < 0) {
+		return (errno == ESRCH) ? 1 : 0;
+	}
+
+	snprintf(buf, sizeof(buf), "/proc/%d/stat", (int)tid);
+	fd = open(buf, O_RDONLY);
+	if (fd < 0) {
+		return 0;
+	}
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0) {
+		return 0;
+	}
+	buf[len] = '\0';
+
+	/* "pid (comm) state ...", the command name may contain parentheses */
+	state = strrchr(buf, ')');
+	if ((state == NULL) || (state[1] == '\0')) {
+		return 0;
+	}
+	return ((state[2] == 'Z') || (state[2] == 'X')) ? 1 : 0;
+}
+
+/* ************************************************************************//**
+ * \brief	Initialization of a semilock object - Process shared futex
+ *
+ * The lock is taken by a CAS of the own thread id into the lock word. A
+ * context finding the lock held spins shortly, then sets FUTEX_WAITERS and
+ * sleeps with a non private FUTEX_WAIT, the lock may be placed in memory
+ * shared between processes. Sleeping contexts check periodically if the
+ * holder still exists and take the lock over from a terminated holder.
+ *
+ * \param	*_lock [out]		The semilock_t data type will be initialized
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * ****************************************************************************/
+static inline int futexlock__init(semilock_t *_lock)
+{
+	if(_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	_lock->owner_died = 0;
+	__atomic_store_n(&_lock->word, 0, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Lock of the semilock object - Process shared futex
+ *
+ * A lock taken over from a terminated holder is entered as usual and counted
+ * in "owner_died", the data it protects may be left inconsistent.
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to check if section
+ * 							is already entered
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * ****************************************************************************/
+static inline int futexlock__lock(semilock_t *_lock)
+{
+	int i, timed_out = 0;
+	uint32_t tid, word;
+	struct timespec check = {
+		.tv_sec = M_LOCK_FUTEX__OWNER_CHECK_MS / 1000,
+		.tv_nsec = (M_LOCK_FUTEX__OWNER_CHECK_MS % 1000) * 1000000L
+	};
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	tid = futexlock_tid();
+	for (i = 0; i < M_LOCK_FUTEX__SPIN_COUNT; i++) {
+		word = 0;
+		if (__atomic_compare_exchange_n(&_lock->word, &word, tid, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+			return LIB_LIST__EOK;
+		}
+		M_LIB_LIST__RELAX();
+	}
+
+	while (1) {
+		word = __atomic_load_n(&_lock->word, __ATOMIC_RELAXED);
+
+		/* Other contexts may sleep, the waiters bit is kept on taking the lock */
+		if (word == 0) {
+			if (__atomic_compare_exchange_n(&_lock->word, &word, tid | FUTEX_WAITERS, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+				return LIB_LIST__EOK;
+			}
+			continue;
+		}
+
+		/* The holder is only checked after a sleep has run into its timeout,
+		 * a holder releasing the lock in time wakes the sleepers anyway */
+		if (timed_out) {
+			timed_out = 0;
+			if (futexlock_owner_dead(word)) {
+				if (__atomic_compare_exchange_n(&_lock->word, &word, tid | (word & FUTEX_WAITERS), 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+					__atomic_add_fetch(&_lock->owner_died, 1, __ATOMIC_RELAXED);
+					return LIB_LIST__EOK;
+				}
+				continue;
+			}
+		}
+
+		if ((word & FUTEX_WAITERS) == 0) {
+			if (!__atomic_compare_exchange_n(&_lock->word, &word, word | FUTEX_WAITERS, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				continue;
+			}
+			word |= FUTEX_WAITERS;
+		}
+
+		if ((syscall(SYS_futex, &_lock->word, FUTEX_WAIT, word, &check, NULL, 0) < 0) && (errno == ETIMEDOUT)) {
+			timed_out = 1;
+		}
+	}
+}
+
+/* ************************************************************************//**
+ * \brief	Unlock of the semilock object - Process shared futex
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to signalizes that a section
+ * 							is left
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_ACCES		: The lock is not held by the calling thread
+ * ****************************************************************************/
+static inline int futexlock__unlock(semilock_t *_lock)
+{
+	uint32_t word;
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if ((__atomic_load_n(&_lock->word, __ATOMIC_RELAXED) & FUTEX_TID_MASK) != futexlock_tid()) {
+		return -LIB_LIST__ESTD_ACCES;
+	}
+
+	word = __atomic_exchange_n(&_lock->word, 0, __ATOMIC_RELEASE);
+	if (word & FUTEX_WAITERS) {
+		syscall(SYS_futex, &_lock->word, FUTEX_WAKE, 1, NULL, NULL, 0);
+	}
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Trylock of the semilock object - Process shared futex
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to check if section
+ * 							is already entered
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_BUSY		: Critical section is already entered by other context
+ * ****************************************************************************/
+static inline int futexlock__trylock(semilock_t *_lock)
+{
+	uint32_t word = 0;
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (__atomic_compare_exchange_n(&_lock->word, &word, futexlock_tid(), 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+		return LIB_LIST__EOK;
+	}
+	return -LIB_LIST__ESTD_BUSY;
+}
+
+#endif /* SH_LOCK_FUTEX_H_ */
@@ -57,6 +57,22 @@ extern "C" {
  * ****************************************************************************/
 int lib_list__init(struct queue_attr *_queue, void *_base);
 
+/* ************************************************************************//**
+ * \brief	Initialization of a bounded icb_fifo list
+ *
+ *  A bounded queue refuses to take more than "_capacity" nodes, all inserting
+ *  operations fail with -ENOSPC instead. The fill level is checked by the
+ *  length counter of the queue attribute.
+ *
+ * \param	*_queue [in]		Initialization of the fifo description attribute
+ * \param	_capacity			Maximum number of nodes, 0 for an unbounded queue
+ * \param	*_base[in]			base mem address
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		NULL pointer check
+ * ****************************************************************************/
+int lib_list__init_bounded(struct queue_attr *_queue, unsigned int _capacity, void *_base);
+
 /* ************************************************************************//**
  * \brief	Enqueue of a list element
  *
@@ -69,9 +85,53 @@ int lib_list__init(struct queue_attr *_queue, void *_base);
  * 			-EEXEC_NOINIT   : Queue is not yet initialized
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: Capacity of a bounded queue is reached
  * ****************************************************************************/
 int lib_list__enqueue(struct queue_attr *_queue, struct list_node * _new, uint32_t _context_id, void *_base);
 
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element, fail fast if the queue is full
+ *
+ *  The fill level of a bounded queue is checked by a lock-free read of the
+ *  length counter, a full queue is reported without entering the critical
+ *  section.
+ *
+ * \param	*_queue [in]		fifo description attribute, to enqueue
+ * \param	*_new [in]			new entry for the list
+ * \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ * \param	*_base[in]			base mem address
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: Capacity of the queue is reached
+ * ****************************************************************************/
+int lib_list__try_enqueue(struct queue_attr *_queue, struct list_node * _new, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element, blocking while the queue is full
+ *
+ *  The calling context sleeps at a non private futex word of the queue
+ *  attribute until a consumer frees an entry of the bounded queue.
+ *
+ * \param	*_queue [in]		fifo description attribute, to enqueue
+ * \param	*_new [in]			new entry for the list
+ * \param	_timeout_ms			maximum time to wait in milliseconds, negative to wait infinitely
+ * \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ * \param	*_base[in]			base mem address
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: Queue is still full after the timeout
+ * 			-ESTD_NOSYS		: No futex support at the target
+ * ****************************************************************************/
+int lib_list__enqueue_wait(struct queue_attr *_queue, struct list_node * _new, int _timeout_ms, uint32_t _context_id, void *_base);
+
 /* ************************************************************************//**
  * \brief	Dequeue of a list element
  *
@@ -89,6 +149,72 @@ int lib_list__enqueue(struct queue_attr *_queue, struct list_node * _new, uint32
  * ****************************************************************************/
 int lib_list__dequeue(struct queue_attr *_queue, struct list_node **_dequeue_node, uint32_t _context_id, void *_base);
 
+/* ************************************************************************//**
+ * \brief	Enqueue of several list elements
+ *
+ *  All passed nodes are enqueued in array order within one critical section.
+ *
+ * \param	*_queue [in]		fifo description attribute, to enqueue
+ * \param	**_nodes [in]		array of new entries for the list
+ * \param	_count				number of entries at "_nodes"
+ * \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ * \param	*_base[in]			base mem address
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: Not all nodes fit into a bounded queue, none is enqueued
+ * ****************************************************************************/
+int lib_list__enqueue_bulk(struct queue_attr *_queue, struct list_node **_nodes, unsigned int _count, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Dequeue of several list elements
+ *
+ *  Up to "_max_count" nodes are dequeued in fifo order within one critical section.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_nodes[out]		 array to store the dequeued list elements
+ *	\param  _max_count			 number of entries at "_nodes", at least one
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return number of dequeued nodes if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EPAR_RANGE		: "_max_count" is zero
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ *
+ * ****************************************************************************/
+int lib_list__dequeue_bulk(struct queue_attr *_queue, struct list_node **_nodes, unsigned int _max_count, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element, blocking while the fifo is empty
+ *
+ *  The calling context sleeps at a futex word inside the queue attribute.
+ *  The futex is not process private, so contexts of different processes
+ *  attached to the same shared segment can wait and wake each other.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_dequeue_node[out] pointer to dequeue a list element
+ *	\param  _timeout_ms			 maximum time to wait in milliseconds, negative to wait infinitely
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is still empty after the timeout
+ * 			-ESTD_NOSYS		: No futex support at the target
+ *
+ * ****************************************************************************/
+int lib_list__dequeue_wait(struct queue_attr *_queue, struct list_node **_dequeue_node, int _timeout_ms, uint32_t _context_id, void *_base);
+
 /* ************************************************************************//**
  * \brief	Get first node
  *
@@ -102,6 +228,7 @@ int lib_list__dequeue(struct queue_attr *_queue, struct list_node **_dequeue_nod
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
  * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
  *
  * ****************************************************************************/
 int lib_list__get_begin(struct queue_attr *_queue, struct list_node ** _begin_node, uint32_t _context_id, void *_base);
@@ -119,6 +246,7 @@ int lib_list__get_begin(struct queue_attr *_queue, struct list_node ** _begin_no
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
  * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
  *
  * ****************************************************************************/
 int lib_list__get_end(struct queue_attr *_queue, struct list_node ** _end_node, uint32_t _context_id, void *_base);
@@ -136,6 +264,7 @@ int lib_list__get_end(struct queue_attr *_queue, struct list_node ** _end_node,
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
  * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
  *
  * ****************************************************************************/
 int lib_list__get_next(struct queue_attr *_queue, struct list_node ** _next_node, uint32_t _context_id, void *_base);
@@ -155,6 +284,8 @@ int lib_list__get_next(struct queue_attr *_queue, struct list_node ** _next_node
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
  * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ * 			-ENOSPC			: Capacity of a bounded queue is reached
  *
  * ****************************************************************************/
 int lib_list__add_after(struct queue_attr *_queue, struct list_node *_pos_after_to_add, struct list_node *_to_add, uint32_t _context_id, void *_base);
@@ -174,6 +305,8 @@ int lib_list__add_after(struct queue_attr *_queue, struct list_node *_pos_after_
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
  * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ * 			-ENOSPC			: Capacity of a bounded queue is reached
  *
  * ****************************************************************************/
 int lib_list__add_before(struct queue_attr *_queue, struct list_node *_pos_before_to_add, struct list_node *_to_add, uint32_t _context_id, void *_base);
@@ -181,6 +314,9 @@ int lib_list__add_before(struct queue_attr *_queue, struct list_node *_pos_befor
 /* ************************************************************************//**
  * \brief	Get delete node
  *
+ *  With CONFIG_LIST__NODE_OWNER a node which is not linked to "_queue" is
+ *  rejected in constant time and the list stays untouched.
+ *
  *  \param	*_queue [in]		 fifo description attribute, to dequeue
  *	\param  **_first_node[out]   pointer to next list element
  *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
@@ -191,7 +327,8 @@ int lib_list__add_before(struct queue_attr *_queue, struct list_node *_pos_befor
  * 			-EEXEC_NOINIT   : Queue is not yet initialized
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_AGAIN		: fifo is empty, or node is not at the queue
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
  *
  * ****************************************************************************/
 int lib_list__delete(struct queue_attr *_queue, struct list_node * _del, uint32_t _context_id, void *_base);
@@ -199,6 +336,9 @@ int lib_list__delete(struct queue_attr *_queue, struct list_node * _del, uint32_
 /* ************************************************************************//**
  * \brief	Check if node is at list
  *
+ *  With CONFIG_LIST__NODE_OWNER the owner tag of the node is compared in
+ *  constant time, otherwise the list is traversed under the lock.
+ *
  *  \param	*_queue [in]		 fifo description attribute, to dequeue
  *	\param  **_first_node[out]   pointer to next list element
  *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
@@ -210,10 +350,128 @@ int lib_list__delete(struct queue_attr *_queue, struct list_node * _del, uint32_
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
  * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
  *
  * ****************************************************************************/
 int lib_list__contains(struct queue_attr *_queue, struct list_node * _node, uint32_t _context_id, void *_base);
 
+/* ************************************************************************//**
+ * \brief	Visit all nodes within one critical section
+ *
+ *  The callback is called for every node in fifo order while the queue is
+ *  locked once, so the walk sees a consistent list. A non-zero return of the
+ *  callback stops the walk. The callback must not call a function of the
+ *  same queue.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to walk
+ *	\param  _callback[in]		 called for every node, returns non-zero to stop
+ *	\param  *_ctx[in]			 user context passed to the callback
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return number of visited nodes if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__for_each(struct queue_attr *_queue, list_visit_t _callback, void *_ctx, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Find the first node matching a predicate within one critical section
+ *
+ *  The predicate is called in fifo order while the queue is locked once, the
+ *  walk stops at the first node it returns non-zero for. The predicate must
+ *  not call a function of the same queue.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to search
+ *	\param  _predicate[in]		 returns non-zero for the node to find
+ *	\param  *_ctx[in]			 user context passed to the predicate
+ *	\param  **_found[out]		 pointer to the first matching list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No node matches
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__find_if(struct queue_attr *_queue, list_visit_t _predicate, void *_ctx, struct list_node **_found, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Remove all nodes matching a predicate within one critical section
+ *
+ *  The queue is walked once while it is locked, every node the predicate
+ *  returns non-zero for is unlinked. The removed nodes are appended in fifo
+ *  order to "_removed", which can be processed with the lib_list__chain_*
+ *  functions. The predicate must not call a function of the same queue.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to remove from
+ *	\param  _predicate[in]		 returns non-zero for every node to remove
+ *	\param  *_ctx[in]			 user context passed to the predicate
+ *	\param  *_removed[out]		 head of a chain initialized by the call, or NULL to drop the nodes
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return number of removed nodes if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__remove_if(struct queue_attr *_queue, list_visit_t _predicate, void *_ctx, struct list_node *_removed, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Copy the node offsets of a queue within one short critical section
+ *
+ *  The base relative offsets of up to "_max" nodes are stored in fifo order
+ *  at "_offsets". The copy loop only follows the links, all inspection work
+ *  runs afterwards without the lock by lib_list__snapshot_next. The caller
+ *  has to ensure the nodes stay valid, e.g. by not releasing them to the
+ *  pool while a snapshot is in use.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to copy
+ *	\param  **_offsets[out]		 buffer for "_max" node offsets
+ *	\param  _max				 number of entries at "_offsets"
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return number of copied offsets if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__snapshot(struct queue_attr *_queue, struct list_node **_offsets, unsigned int _max, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Iterate the nodes of a snapshot without any lock
+ *
+ *  "*_pos" has to be 0 for the first call and is advanced by every call.
+ *
+ *	\param  **_offsets[in]		 node offsets of lib_list__snapshot
+ *	\param  _count				 number of offsets returned by lib_list__snapshot
+ *	\param  *_pos[in,out]		 current position of the iteration
+ *	\param  **_node[out]		 pointer to the next list element
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_AGAIN		: All nodes of the snapshot are passed
+ *
+ * ****************************************************************************/
+int lib_list__snapshot_next(struct list_node **_offsets, unsigned int _count, unsigned int *_pos, struct list_node **_node, void *_base);
+
 /* ************************************************************************//**
  * \brief	Check if list is emty
  *
@@ -234,6 +492,8 @@ int lib_list__emty(struct queue_attr *_queue, uint32_t _context_id, void *_base)
 /* ************************************************************************//**
  * \brief	Request number of queue entries
  *
+ *  The length is maintained by all modifying operations, the call is O(1)
+ *
  *  \param	*_queue [in]		 fifo description attribute, to dequeue
  *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
  *  \param	*_base[in]			 base mem address
@@ -248,11 +508,954 @@ int lib_list__emty(struct queue_attr *_queue, uint32_t _context_id, void *_base)
  * ****************************************************************************/
 int lib_list__count(struct queue_attr *_queue, uint32_t _context_id, void *_base);
 
+/* ************************************************************************//**
+ * \brief	Request number of queue entries without lock
+ *
+ *  The length maintained at the queue attribute is read by an atomic load.
+ *  The value may be outdated as soon as it is returned, it is intended
+ *  for depth monitoring.
+ *
+ *  \param	*_queue [in]		 fifo description attribute
+ *
+ *	\return number of entries if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ *
+ * ****************************************************************************/
+int lib_list__count_relaxed(struct queue_attr *_queue);
+
+
+/* ************************************************************************//**
+ * \brief	Move all nodes of a queue to the end of another queue
+ *
+ *  Both queues are locked once (in address order), the chain of "_src" is
+ *  linked as a whole behind the last node of "_dst". "_src" is left empty.
+ *  With CONFIG_LIST__NODE_OWNER the owner tag of every moved node is updated.
+ *
+ *  \param	*_dst [in]			 fifo description attribute, to append the nodes
+ *  \param	*_src [in]			 fifo description attribute, to take the nodes from
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_INVAL		: "_dst" and "_src" are the same queue
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: The nodes of "_src" do not fit into the bounded "_dst"
+ *
+ * ****************************************************************************/
+int lib_list__splice(struct queue_attr *_dst, struct queue_attr *_src, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Detach all nodes of a queue into a private chain
+ *
+ *  The whole chain is moved to "_chain" within one critical section. The
+ *  chain is owned by the caller and can be processed with the lib_list__chain_*
+ *  functions without any lock. With lock_free the nodes are detached one by
+ *  one, at most as many as the queue held at the call; nodes enqueued
+ *  meanwhile may stay in the queue.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to take the nodes from
+ *	\param  *_chain[out]		 head of the private chain, initialized by the call
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ *
+ * ****************************************************************************/
+int lib_list__take_all(struct queue_attr *_queue, struct list_node *_chain, uint32_t _context_id, void *_base);
+
 
 struct list_node* ITR_BEGIN(struct queue_attr *_queue, uint32_t _context_id, void *_base);
 struct list_node* ITR_END(struct queue_attr *_queue, uint32_t _context_id, void *_base);
 void ITR_NEXT(struct queue_attr *_queue, struct list_node **_itr_node,  uint32_t _context_id, void *_base);
 
+/* *******************************************************************
+ * Global Functions - CHAIN HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a private chain
+ *
+ *  A chain is a list head owned by a single context. It uses the same base
+ *  relative node format as the queues, but is accessed without any lock.
+ *
+ *	\param  *_chain[out]		 head of the chain
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__chain_init(struct list_node *_chain, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Take the first node of a private chain
+ *
+ *	\param  *_chain[in]			 head of the chain
+ *	\param  **_node[out]		 pointer to the detached list element
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_AGAIN		: chain is empty
+ *
+ * ****************************************************************************/
+int lib_list__chain_dequeue(struct list_node *_chain, struct list_node **_node, void *_base);
+
+/* *******************************************************************
+ * Global Functions - SPSC CHANNEL HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Calculation of the required channel size
+ *
+ *  The channel consists of the "struct spsc_attr" followed by "_capacity"
+ *  node slots. The returned size has to be provided at the shared segment.
+ *
+ *	\param  _capacity		 number of nodes the channel can hold (power of two)
+ *
+ *	\return "channel_size" if successful, or negative errno value on error
+ * 			-LIB_LIST__ESTD_INVAL	: Capacity is 0, not a power of two or the
+ * 									  size exceeds INT_MAX
+ *
+ * ****************************************************************************/
+int lib_list__spsc_calc_size(unsigned int _capacity);
+
+/* ************************************************************************//**
+ * \brief	Initialization of a single producer / single consumer channel
+ *
+ *  \param	*_spsc [out]	channel with a size of "lib_list__spsc_calc_size"
+ *	\param  _capacity		number of nodes the channel can hold (power of two)
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__ESTD_INVAL	: Capacity is 0, not a power of two or too large
+ *
+ * ****************************************************************************/
+int lib_list__spsc_init(struct spsc_attr *_spsc, unsigned int _capacity);
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element - producer side
+ *
+ *  Wait free, must only be called by the one producing context.
+ *
+ *  \param	*_spsc [in]		channel to enqueue
+ *	\param  *_new [in]		new entry for the channel
+ *  \param	*_base[in]		base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Channel is not yet initialized
+ * 			-LIB_LIST__ENOSPC		: Channel is full
+ *
+ * ****************************************************************************/
+int lib_list__spsc_enqueue(struct spsc_attr *_spsc, struct list_node *_new, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element - consumer side
+ *
+ *  Wait free, must only be called by the one consuming context.
+ *
+ *  \param	*_spsc [in]				channel to dequeue
+ *	\param  **_dequeue_node[out]	pointer to dequeue a list element
+ *  \param	*_base[in]				base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Channel is not yet initialized
+ * 			-LIB_LIST__ESTD_AGAIN	: Channel is empty
+ *
+ * ****************************************************************************/
+int lib_list__spsc_dequeue(struct spsc_attr *_spsc, struct list_node **_dequeue_node, void *_base);
+
+/* *******************************************************************
+ * Global Functions - PRIORITY QUEUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a priority queue
+ *
+ *  \param	*_queue [in]		priority queue description attribute
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__prio_init(struct prio_queue_attr *_queue, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element at a priority level
+ *
+ *  The node is appended to the fifo of level "_prio", nodes of the same
+ *  level are dequeued in fifo order.
+ *
+ *  \param	*_queue [in]		priority queue description attribute
+ *	\param  *_new [in]			new entry for the queue
+ *	\param  _prio				priority level, 0 (lowest) up to M_LIB_LIST__PRIO_LEVELS - 1
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-EPAR_RANGE		: Priority level out of range
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__prio_enqueue(struct prio_queue_attr *_queue, struct list_node *_new, unsigned int _prio, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Dequeue of the oldest list element of the highest non-empty level
+ *
+ *  The level is found by one count leading zeros of the non-empty bitmap.
+ *  An empty queue is reported by a read of the bitmap, without taking the lock.
+ *
+ *  \param	*_queue [in]		 priority queue description attribute
+ *	\param  **_dequeue_node[out] pointer to dequeue a list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: all levels are empty
+ *
+ * ****************************************************************************/
+int lib_list__prio_dequeue(struct prio_queue_attr *_queue, struct list_node **_dequeue_node, uint32_t _context_id, void *_base);
+
+/* *******************************************************************
+ * Global Functions - SKIP LIST HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a skip list
+ *
+ *  \param	*_skip [in]			skip list description attribute
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__skip_init(struct skip_attr *_skip, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Sorted insert of a node
+ *
+ *  The node is placed behind all nodes with a lower or equal key, so nodes
+ *  of the same key keep their insertion order. The position is found in
+ *  O(log n) by the index levels.
+ *
+ *  \param	*_skip [in]			skip list description attribute
+ *	\param  *_new [in]			new entry for the skip list
+ *	\param  _key				sort key of the new entry
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__skip_insert(struct skip_attr *_skip, struct skip_node *_new, uint64_t _key, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Find the first node of a key
+ *
+ *  \param	*_skip [in]			skip list description attribute
+ *	\param  _key				key to search for
+ *	\param  **_found[out]		pointer to the first node with "_key"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No node with "_key"
+ *
+ * ****************************************************************************/
+int lib_list__skip_find(struct skip_attr *_skip, uint64_t _key, struct skip_node **_found, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Delete a node
+ *
+ *  The node is located in O(log n) by its key, nodes of the same key are
+ *  passed linearly.
+ *
+ *  \param	*_skip [in]			skip list description attribute
+ *	\param  *_del [in]			node to delete
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: Node is not at the skip list
+ *
+ * ****************************************************************************/
+int lib_list__skip_delete(struct skip_attr *_skip, struct skip_node *_del, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Dequeue of the node with the lowest key
+ *
+ *  \param	*_skip [in]			 skip list description attribute
+ *	\param  **_dequeue_node[out] pointer to the dequeued node
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: skip list is empty
+ *
+ * ****************************************************************************/
+int lib_list__skip_dequeue(struct skip_attr *_skip, struct skip_node **_dequeue_node, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	In-order iteration of the bottom level
+ *
+ *  Passing NULL at "*_next_node" returns the node with the lowest key, every
+ *  further call returns the successor of the passed node.
+ *
+ *  \param	*_skip [in]			 skip list description attribute
+ *	\param  **_next_node[in,out] current node, replaced by its successor
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No further node
+ *
+ * ****************************************************************************/
+int lib_list__skip_get_next(struct skip_attr *_skip, struct skip_node **_next_node, uint32_t _context_id, void *_base);
+
+/* *******************************************************************
+ * Global Functions - TWO LOCK QUEUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a two lock queue
+ *
+ *  \param	*_queue [in]		two lock queue description attribute, aligned to
+ *  							M_LIB_LIST__CACHE_LINE_SIZE
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__twolock_init(struct twolock_attr *_queue, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element - only the tail lock is taken
+ *
+ *  \param	*_queue [in]		two lock queue description attribute
+ *	\param  *_new [in]			new entry for the queue
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__twolock_enqueue(struct twolock_attr *_queue, struct list_node *_new, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element - only the head lock is taken
+ *
+ *  If the last node is dequeued, the stub is linked behind it under the tail
+ *  lock, this is the only case both locks are held (head before tail).
+ *
+ *  \param	*_queue [in]		 two lock queue description attribute
+ *	\param  **_dequeue_node[out] pointer to dequeue a list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: queue is empty
+ *
+ * ****************************************************************************/
+int lib_list__twolock_dequeue(struct twolock_attr *_queue, struct list_node **_dequeue_node, uint32_t _context_id, void *_base);
+
+/* *******************************************************************
+ * Global Functions - MPSC QUEUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a multi producer / single consumer queue
+ *
+ *  \param	*_mpsc [out]	queue description attribute
+ *  \param	*_base[in]		base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__mpsc_init(struct mpsc_attr *_mpsc, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element - producer side
+ *
+ *  Wait free, a single atomic exchange. Can be called by any number of
+ *  producing contexts.
+ *
+ *  \param	*_mpsc [in]		queue to enqueue
+ *	\param  *_new [in]		new entry for the queue
+ *  \param	*_base[in]		base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Queue is not yet initialized
+ *
+ * ****************************************************************************/
+int lib_list__mpsc_enqueue(struct mpsc_attr *_mpsc, struct list_node *_new, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element - consumer side
+ *
+ *  Must only be called by the one consuming context. If a producer has
+ *  exchanged the tail but not yet linked its node, the queue is reported as
+ *  empty and the consumer has to retry.
+ *
+ *  \param	*_mpsc [in]				queue to dequeue
+ *	\param  **_dequeue_node[out]	pointer to dequeue a list element
+ *  \param	*_base[in]				base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Queue is not yet initialized
+ * 			-LIB_LIST__ESTD_AGAIN	: Queue is empty or an enqueue is in progress
+ *
+ * ****************************************************************************/
+int lib_list__mpsc_dequeue(struct mpsc_attr *_mpsc, struct list_node **_dequeue_node, void *_base);
+
+/* *******************************************************************
+ * Global Functions - SHARDED QUEUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Calculation of the required sharded queue size
+ *
+ *  The sharded queue consists of the "struct sharded_attr" followed by
+ *  "_shard_count" cache line aligned shards.
+ *
+ *	\param  _shard_count		 number of shards, usually the number of contexts
+ *
+ *	\return "sharded_size" if successful, or negative errno value on error
+ * 			-LIB_LIST__ESTD_INVAL	: Shard count is 0
+ *
+ * ****************************************************************************/
+int lib_list__sharded_calc_size(unsigned int _shard_count);
+
+/* ************************************************************************//**
+ * \brief	Initialization of a sharded queue
+ *
+ *  \param	*_sharded [out]		sharded queue with a size of "lib_list__sharded_calc_size",
+ *  							aligned to M_LIB_LIST__CACHE_LINE_SIZE
+ *	\param  _shard_count		number of shards
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__ESTD_INVAL	: Shard count is 0
+ *
+ * ****************************************************************************/
+int lib_list__sharded_init(struct sharded_attr *_sharded, unsigned int _shard_count, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element to the local shard
+ *
+ *  The shard is selected by "_context_id" modulo the shard count, contexts
+ *  of different shards never contend.
+ *
+ *  \param	*_sharded [in]		sharded queue description attribute
+ *	\param  *_new [in]			new entry for the queue
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__sharded_enqueue(struct sharded_attr *_sharded, struct list_node *_new, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element, local shard first
+ *
+ *  If the local shard is empty, the other shards are tried round robin,
+ *  starting behind the local one. Shards with a length of 0 are passed
+ *  without taking their lock. The fifo order is only kept per shard.
+ *
+ *  \param	*_sharded [in]		 sharded queue description attribute
+ *	\param  **_dequeue_node[out] pointer to dequeue a list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: all shards are empty
+ *
+ * ****************************************************************************/
+int lib_list__sharded_dequeue(struct sharded_attr *_sharded, struct list_node **_dequeue_node, uint32_t _context_id, void *_base);
+
+/* *******************************************************************
+ * Global Functions - WORK STEALING DEQUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Calculation of the required deque size
+ *
+ *  The deque consists of the "struct deque_attr" followed by "_capacity"
+ *  node slots. The returned size has to be provided at the shared segment.
+ *
+ *	\param  _capacity		 number of nodes the deque can hold (power of two)
+ *
+ *	\return "deque_size" if successful, or negative errno value on error
+ * 			-LIB_LIST__ESTD_INVAL	: Capacity is 0, not a power of two or the
+ * 									  size exceeds INT_MAX
+ *
+ * ****************************************************************************/
+int lib_list__deque_calc_size(unsigned int _capacity);
+
+/* ************************************************************************//**
+ * \brief	Initialization of a work stealing deque
+ *
+ *  \param	*_deque [out]	deque with a size of "lib_list__deque_calc_size"
+ *	\param  _capacity		number of nodes the deque can hold (power of two)
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__ESTD_INVAL	: Capacity is 0, not a power of two or too large
+ *
+ * ****************************************************************************/
+int lib_list__deque_init(struct deque_attr *_deque, unsigned int _capacity);
+
+/* ************************************************************************//**
+ * \brief	Push of a list element - owner side
+ *
+ *  Must only be called by the owning context, no atomic read-modify-write.
+ *
+ *  \param	*_deque [in]	deque to push to
+ *	\param  *_new [in]		new entry for the deque
+ *  \param	*_base[in]		base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Deque is not yet initialized
+ * 			-LIB_LIST__ENOSPC		: Deque is full
+ *
+ * ****************************************************************************/
+int lib_list__deque_push(struct deque_attr *_deque, struct list_node *_new, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Pop of the latest pushed list element - owner side
+ *
+ *  Must only be called by the owning context. A CAS is only required if the
+ *  last node is raced with a thief.
+ *
+ *  \param	*_deque [in]			deque to pop from
+ *	\param  **_dequeue_node[out]	pointer to the popped list element
+ *  \param	*_base[in]				base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Deque is not yet initialized
+ * 			-LIB_LIST__ESTD_AGAIN	: Deque is empty
+ *
+ * ****************************************************************************/
+int lib_list__deque_pop(struct deque_attr *_deque, struct list_node **_dequeue_node, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Steal of the oldest list element - thief side
+ *
+ *  Can be called by any context. The top is advanced by CAS, a lost race
+ *  with another thief or the owner is reported as -ESTD_BUSY.
+ *
+ *  \param	*_deque [in]			deque to steal from
+ *	\param  **_dequeue_node[out]	pointer to the stolen list element
+ *  \param	*_base[in]				base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Deque is not yet initialized
+ * 			-LIB_LIST__ESTD_AGAIN	: Deque is empty
+ * 			-LIB_LIST__ESTD_BUSY	: Race with another context lost, retry
+ *
+ * ****************************************************************************/
+int lib_list__deque_steal(struct deque_attr *_deque, struct list_node **_dequeue_node, void *_base);
+
+/* *******************************************************************
+ * Global Functions - TIMING WHEEL HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a timing wheel
+ *
+ *  \param	*_wheel [in]		timing wheel description attribute
+ *	\param  _now				current tick, the first tick processed by advance is "_now" + 1
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__wheel_init(struct wheel_attr *_wheel, uint64_t _now, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Schedule a timer
+ *
+ *  The timer is linked to the slot of its level in O(1). A timer with an
+ *  expiry tick already processed is handed back by the next advance.
+ *
+ *  \param	*_wheel [in]		timing wheel description attribute
+ *	\param  *_timer [in]		timer to schedule, zero initialized or not pending anymore
+ *	\param  _expires			absolute expiry tick
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Wheel is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__wheel_schedule(struct wheel_attr *_wheel, struct wheel_timer *_timer, uint64_t _expires, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Cancel a scheduled timer
+ *
+ *  The timer is unlinked in O(1). A timer which is not pending anymore, i.e.
+ *  already cancelled or handed back by lib_list__wheel_advance, is left alone.
+ *
+ *  \param	*_wheel [in]		timing wheel description attribute
+ *	\param  *_timer [in]		timer to cancel
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Wheel is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: The timer is not pending
+ *
+ * ****************************************************************************/
+int lib_list__wheel_cancel(struct wheel_attr *_wheel, struct wheel_timer *_timer, uint32_t _context_id, void *_base);
+
+/* ************************************************************************//**
+ * \brief	Advance the wheel up to a tick and take the expired timers
+ *
+ *  All ticks up to "_now" are processed, the slots of the upper levels are
+ *  cascaded when their range is reached. Ticks without work are skipped with
+ *  the slot bitmaps, the cost does not grow with the distance to "_now". The
+ *  expired timers are handed to "_expired" in expiry order, which can be
+ *  processed with the lib_list__chain_* functions.
+ *
+ *  \param	*_wheel [in]		timing wheel description attribute
+ *	\param  _now				current tick
+ *	\param  *_expired[out]		head of a chain initialized by the call
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Wheel is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No timer expired
+ *
+ * ****************************************************************************/
+int lib_list__wheel_advance(struct wheel_attr *_wheel, uint64_t _now, struct list_node *_expired, uint32_t _context_id, void *_base);
+
+/* *******************************************************************
+ * Global Functions - HASH TABLE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a hash table
+ *
+ *  The bucket array is allocated from the memory region of "_hdl", all links
+ *  are relative to the base of the region. The table and its entries have to
+ *  be placed in the region too, to be shared between processes.
+ *
+ *  \param	*_hash [in]			hash table description attribute, aligned to
+ *  							M_LIB_LIST__CACHE_LINE_SIZE
+ *	\param  _bucket_count		initial number of buckets, a power of two of at least M_LIB_LIST__HASH_STRIPES
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Memory region is not yet set up
+ * 			-EPAR_RANGE		: Invalid number of buckets
+ * 			-ENOSPC			: Not enough memory for the bucket array
+ *
+ * ****************************************************************************/
+int lib_list__hash_init(struct hash_attr *_hash, uint32_t _bucket_count, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Insert a node with a key
+ *
+ *  Only the stripe of the key is locked. Keys are not checked for uniqueness,
+ *  lib_list__hash_find returns the oldest node of a key. Above a mean of
+ *  M_LIB_LIST__HASH_LOAD_FACTOR nodes per bucket the table is doubled; the
+ *  nodes are moved to the new buckets incrementally by the following
+ *  operations of each stripe. The table is left at its size if the region
+ *  has no space for a larger bucket array.
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *	\param  *_new [in]			node to insert, placed in the memory region
+ *	\param  _key				key of the node
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__hash_insert(struct hash_attr *_hash, struct hash_node *_new, uint64_t _key, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Find the oldest node of a key
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *	\param  _key				key to search for
+ *	\param  **_found[out]		pointer to the node with "_key"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No node with "_key"
+ *
+ * ****************************************************************************/
+int lib_list__hash_find(struct hash_attr *_hash, uint64_t _key, struct hash_node **_found, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Delete a node
+ *
+ *  The node is unlinked in O(1), the caller has to ensure it is part of the
+ *  table.
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *	\param  *_del [in]			node to delete
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__hash_delete(struct hash_attr *_hash, struct hash_node *_del, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Resize the bucket array
+ *
+ *  The new array is allocated and swapped in while all stripes are locked
+ *  for a moment; the nodes are moved incrementally by the following
+ *  operations of each stripe. A resize still in progress is completed first.
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *	\param  _bucket_count		new number of buckets, a power of two of at least M_LIB_LIST__HASH_STRIPES
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
+ * 			-EPAR_RANGE		: Invalid number of buckets
+ * 			-ENOSPC			: Not enough memory for the bucket array
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__hash_resize(struct hash_attr *_hash, uint32_t _bucket_count, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Number of nodes of the hash table
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *
+ *	\return number of nodes, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
+ *
+ * ****************************************************************************/
+int lib_list__hash_count(struct hash_attr *_hash);
+
+/* *******************************************************************
+ * Global Functions - LRU CACHE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a LRU cache
+ *
+ *  The bucket array of the key index is allocated from the memory region of
+ *  "_hdl", all links are relative to the base of the region. The cache and
+ *  its entries have to be placed in the region too, to be shared between
+ *  processes.
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  _capacity			maximum number of entries
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Memory region is not yet set up
+ * 			-EPAR_RANGE		: Capacity of zero
+ * 			-ENOSPC			: Not enough memory for the bucket array
+ *
+ * ****************************************************************************/
+int lib_list__lru_init(struct lru_attr *_lru, uint32_t _capacity, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Look up an entry and mark it as most recently used
+ *
+ *  The entry stays owned by the cache, it can be evicted by another context
+ *  as soon as the call returns.
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  _key				key to search for
+ *	\param  **_found[out]		pointer to the entry with "_key"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No entry with "_key"
+ *
+ * ****************************************************************************/
+int lib_list__lru_get(struct lru_attr *_lru, uint64_t _key, struct lru_node **_found, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Insert an entry as most recently used
+ *
+ *  An entry with the same key is replaced. If the capacity is exceeded, the
+ *  least recently used entry is evicted. Replaced and evicted entries are
+ *  passed to "_evict" after the critical section is left, without a callback
+ *  they are returned to the memory region by lib_list__mem_free.
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  *_new [in]			entry to insert, placed in the memory region
+ *	\param  _key				key of the entry
+ *	\param  _evict				eviction callback or NULL
+ *	\param  *_evict_ctx			context passed to "_evict"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__lru_put(struct lru_attr *_lru, struct lru_node *_new, uint64_t _key, lru_evict_t _evict, void *_evict_ctx, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Mark an entry as most recently used
+ *
+ *  The caller has to ensure the entry is still part of the cache.
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  *_node [in]			entry of the cache
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__lru_touch(struct lru_attr *_lru, struct lru_node *_node, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Evict the least recently used entry
+ *
+ *  The entry is passed to "_evict" after the critical section is left,
+ *  without a callback it is returned to the memory region by
+ *  lib_list__mem_free.
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  _evict				eviction callback or NULL
+ *	\param  *_evict_ctx			context passed to "_evict"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: LRU cache is empty
+ *
+ * ****************************************************************************/
+int lib_list__lru_evict(struct lru_attr *_lru, lru_evict_t _evict, void *_evict_ctx, uint32_t _context_id, mem_hdl_t *_hdl);
+
+/* ************************************************************************//**
+ * \brief	Number of entries of the LRU cache
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *
+ *	\return number of entries, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
+ *
+ * ****************************************************************************/
+int lib_list__lru_count(struct lru_attr *_lru);
+
 /* *******************************************************************
  * Global Functions - MEMORY HANDLING
  * ******************************************************************/
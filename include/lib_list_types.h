@@ -46,18 +46,38 @@ extern "C" {
 
 /* project */
 
+#ifdef CONFIG_LIST__LOCK_TYPE_ATOMIC
+	#include "lock_atomic_types.h"
+#endif
+
 #ifdef CONFIG_LIST__LOCK_TYPE_CAS
 	#include "lock_cas_types.h"
 #endif
 
+#ifdef CONFIG_LIST__LOCK_TYPE_FUTEX
+	#include "lock_futex_types.h"
+#endif
+
 #ifdef CONFIG_LIST__LOCK_TYPE_MEM
 	#include "lock_mem_types.h"
 #endif
 
+#ifdef CONFIG_LIST__LOCK_TYPE_MCS
+	#include "lock_mcs_types.h"
+#endif
+
 #ifdef CONFIG_LIST__LOCK_TYPE_MTX
 	#include "lock_mtx_types.h"
 #endif
 
+#ifdef CONFIG_LIST__LOCK_TYPE_TICKET
+	#include "lock_ticket_types.h"
+#endif
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	#include "lock_free_types.h"
+#endif
+
 #ifdef CONFIG_LIST__LOCK_TYPE_FREERTOS
 	#include "lock_freertos_types.h"
 #endif
@@ -77,6 +97,8 @@ extern "C" {
 	#define LIB_LIST__EPAR_RANGE		EPAR_RANGE
 	#define LIB_LIST__ESTD_ACCES		ESTD_ACCES
 	#define LIB_LIST__LIST_OVERFLOW		ELIST_OVERFLOW
+	#define LIB_LIST__ESTD_NOSYS		ESTD_NOSYS
+	#define LIB_LIST__ESTD_BUSY			ESTD_BUSY
 #else
 	#define LIB_LIST__EOK				0
 	#define LIB_LIST__ESTD_AGAIN		EAGAIN
@@ -88,9 +110,52 @@ extern "C" {
 	#define LIB_LIST__EPAR_RANGE 		ENFILE
 	#define LIB_LIST__ESTD_ACCES		EACCES
 	#define LIB_LIST__LIST_OVERFLOW 	EOVERFLOW
+	#define LIB_LIST__ESTD_NOSYS		ENOSYS
+	#define LIB_LIST__ESTD_BUSY			EBUSY
 #endif
 
 
+#ifndef M_LIB_LIST__CACHE_LINE_SIZE
+	#define M_LIB_LIST__CACHE_LINE_SIZE							64
+#endif
+
+/* Spin loop hint of the lock back-ends, lowers the power and the pipeline
+ * flush on leaving the loop */
+#if defined(__i386__) || defined(__x86_64__)
+	#define M_LIB_LIST__RELAX()									__builtin_ia32_pause()
+#elif defined(__aarch64__)
+	#define M_LIB_LIST__RELAX()									__asm__ __volatile__ ("yield" ::: "memory")
+#else
+	#define M_LIB_LIST__RELAX()									__asm__ __volatile__ ("" ::: "memory")
+#endif
+
+/* Number of levels of a priority queue, one bit of the non-empty bitmap each */
+#define M_LIB_LIST__PRIO_LEVELS								32
+
+/* Number of index levels above the list_node level of a skip list, with a
+ * promotion probability of 1/4 sufficient for 4^M_LIB_LIST__SKIP_LEVELS nodes */
+#ifndef M_LIB_LIST__SKIP_LEVELS
+	#define M_LIB_LIST__SKIP_LEVELS								12
+#endif
+
+/* Timing wheel geometry, 64 slots per level (one bit of a 64 bit bitmap
+ * each), M_LIB_LIST__WHEEL_LEVELS levels cover 2^(6 * levels) ticks */
+#define M_LIB_LIST__WHEEL_SLOT_BITS							6
+#define M_LIB_LIST__WHEEL_SLOTS								(1U << M_LIB_LIST__WHEEL_SLOT_BITS)
+#ifndef M_LIB_LIST__WHEEL_LEVELS
+	#define M_LIB_LIST__WHEEL_LEVELS							4
+#endif
+
+/* Lock stripes of a hash table, bucket "n" is guarded by stripe "n % stripes".
+ * Bucket counts are powers of two of at least M_LIB_LIST__HASH_STRIPES. */
+#ifndef M_LIB_LIST__HASH_STRIPES
+	#define M_LIB_LIST__HASH_STRIPES							16
+#endif
+/* Mean entries per bucket above which the table is doubled, and old buckets
+ * migrated per operation while a resize is in progress */
+#define M_LIB_LIST__HASH_LOAD_FACTOR						2
+#define M_LIB_LIST__HASH_MIGRATE_STEPS						2
+
 #define M_MEM_SIZE_1__MEM_INFO_ATTR								(sizeof(struct mem_info_attr))
 #define M_MEM_SIZE_2__ENTRY_LOCK(_entry_count)					(sizeof(uint32_t) * _entry_count)
 #define M_MEM_SIZE_3__ENTRY_DATA(_entry_count, _entry_size)		(_entry_count * _entry_size)
@@ -103,14 +168,203 @@ enum mem_setup_mode {
 	MEM_SETUP_MODE_slave
 };
 
+/* With CONFIG_LIST__NODE_OWNER each node records the queue it is linked to,
+ * as base relative address with the lowest bit set (0 if not linked) */
 struct list_node {
 	struct list_node *next, *prev;
+#ifdef CONFIG_LIST__NODE_OWNER
+	uintptr_t owner;
+#endif
+};
+
+/* Wait condition of a queue, "event" is the futex word which is changed at
+ * every signal, "waiters" counts the contexts sleeping on it */
+struct queue_wait {
+	volatile uint32_t event;
+	volatile uint32_t waiters;
 };
 
 struct queue_attr {
 	struct list_node head;
 	semilock_t lock;
 	unsigned int initialized;
+	volatile uint32_t length;
+	uint32_t capacity;
+	struct queue_wait not_emty;
+	struct queue_wait not_full;
+};
+
+/* Priority queue with one fifo head per level, all levels are protected by
+ * the same lock. Bit "n" of "bitmap" is set while level "n" holds nodes, the
+ * highest set bit is the highest non-empty priority. */
+struct prio_queue_attr {
+	struct list_node head[M_LIB_LIST__PRIO_LEVELS];
+	semilock_t lock;
+	unsigned int initialized;
+	volatile uint32_t bitmap;
+	volatile uint32_t length;
+};
+
+/* Node of a skip list. "node" is the bottom level and keeps all nodes in key
+ * order, "index" holds the base relative forward links of the "height" upper
+ * levels the node is promoted to. */
+struct skip_node {
+	struct list_node node;
+	uint64_t key;
+	uint32_t height;
+	struct skip_node *index[M_LIB_LIST__SKIP_LEVELS];
+};
+
+/* Ordered container, "head" is the sentinel of the bottom list and of all
+ * index levels. "height" is the number of index levels currently in use. */
+struct skip_attr {
+	struct skip_node head;
+	semilock_t lock;
+	unsigned int initialized;
+	uint32_t height;
+	uint32_t seed;
+	volatile uint32_t length;
+};
+
+/* One end of a two lock queue, aligned to a cache line of its own so the
+ * producer and the consumer side do not share the lock line */
+struct twolock_end {
+	semilock_t lock;
+	struct list_node *node;
+} __attribute__((aligned(M_LIB_LIST__CACHE_LINE_SIZE)));
+
+/* Two lock queue (Michael-Scott). Enqueue only takes the "tail" lock and
+ * dequeue only the "head" lock. The nodes are single linked through "next",
+ * a node linked to itself ends the list. "stub" is the initial sentinel and
+ * is linked in again whenever the last node is dequeued. */
+struct twolock_attr {
+	struct twolock_end head;
+	struct twolock_end tail;
+	struct list_node stub;
+	unsigned int initialized;
+};
+
+/* Single producer / single consumer channel. The consumer owned "head" and
+ * the producer owned "tail" position are placed on separate cache lines,
+ * each side caches the last seen position of the other side. The slots hold
+ * base relative offsets of the enqueued list nodes. */
+struct spsc_attr {
+	volatile uint32_t head;
+	uint32_t tail_cache;
+	uint8_t head_pad[M_LIB_LIST__CACHE_LINE_SIZE - 2 * sizeof(uint32_t)];
+	volatile uint32_t tail;
+	uint32_t head_cache;
+	uint8_t tail_pad[M_LIB_LIST__CACHE_LINE_SIZE - 2 * sizeof(uint32_t)];
+	uint32_t capacity;
+	unsigned int initialized;
+	struct list_node *slot[];
+};
+
+/* Intrusive multi producer / single consumer queue (Vyukov). Producers only
+ * exchange "tail", which is placed on a cache line of its own. "head" and
+ * "stub" are consumer owned. The nodes are single linked through "next", a
+ * node linked to itself ends the list. */
+struct mpsc_attr {
+	struct list_node *tail;
+	uint8_t tail_pad[M_LIB_LIST__CACHE_LINE_SIZE - sizeof(struct list_node*)];
+	struct list_node *head;
+	unsigned int initialized;
+	struct list_node stub;
+};
+
+/* Shard of a sharded queue, aligned to cache lines of its own */
+struct queue_shard {
+	struct queue_attr queue;
+} __attribute__((aligned(M_LIB_LIST__CACHE_LINE_SIZE)));
+
+/* Sharded queue, "shard_count" independent queues. A context enqueues to the
+ * shard of its context id and steals from the other shards if it is empty. */
+struct sharded_attr {
+	uint32_t shard_count;
+	unsigned int initialized;
+	struct queue_shard shard[];
+};
+
+/* Work stealing deque (Chase-Lev) of one owner. Thieves advance "top" by CAS,
+ * the owner pushes and pops at "bottom"; both are placed on cache lines of
+ * their own. The slots hold base relative offsets of the list nodes. */
+struct deque_attr {
+	volatile int64_t top;
+	uint8_t top_pad[M_LIB_LIST__CACHE_LINE_SIZE - sizeof(int64_t)];
+	volatile int64_t bottom;
+	uint8_t bottom_pad[M_LIB_LIST__CACHE_LINE_SIZE - sizeof(int64_t)];
+	uint32_t capacity;
+	unsigned int initialized;
+	struct list_node *slot[];
+};
+
+/* Timer of a timing wheel, "expires" is the absolute tick. "pending" is set
+ * while the timer is linked into a slot of the wheel. */
+struct wheel_timer {
+	struct list_node node;
+	uint64_t expires;
+	unsigned int pending;
+};
+
+/* Hierarchical timing wheel. Every slot is a base relative list head, bit
+ * "n" of "bitmap[level]" is set while slot "n" of the level holds timers.
+ * "now" is the last processed tick. */
+struct wheel_attr {
+	struct list_node slot[M_LIB_LIST__WHEEL_LEVELS][M_LIB_LIST__WHEEL_SLOTS];
+	uint64_t bitmap[M_LIB_LIST__WHEEL_LEVELS];
+	uint64_t now;
+	semilock_t lock;
+	unsigned int initialized;
+};
+
+/* Entry of a hash table */
+struct hash_node {
+	struct list_node node;
+	uint64_t key;
+};
+
+/* Lock stripe of a hash table, aligned to a cache line of its own so contexts
+ * working on different stripes do not share the lock line. "migrate_pos" is
+ * the next old bucket of the stripe to move while resizing. */
+struct hash_stripe {
+	semilock_t lock;
+	uint32_t migrate_pos;
+} __attribute__((aligned(M_LIB_LIST__CACHE_LINE_SIZE)));
+
+/* Hash table in a memory region of lib_list__mem_setup. The bucket arrays are
+ * allocated from the region and referenced base relative. While resizing,
+ * "old_bucket" holds the previous array until all stripes are migrated to
+ * "bucket". */
+struct hash_attr {
+	struct hash_stripe stripe[M_LIB_LIST__HASH_STRIPES];
+	struct list_node *bucket;
+	struct list_node *old_bucket;
+	uint32_t bucket_count;
+	uint32_t old_count;
+	volatile uint32_t stripes_done;
+	volatile uint32_t length;
+	unsigned int initialized;
+};
+
+/* Entry of a LRU cache, linked to a bucket of the key index by "entry" and
+ * to the recency chain by "recency" */
+struct lru_node {
+	struct hash_node entry;
+	struct list_node recency;
+};
+
+/* LRU cache of up to "capacity" entries in a memory region of
+ * lib_list__mem_setup. The bucket array of the key index is allocated from
+ * the region and referenced base relative, the recency chain runs from the
+ * least to the most recently used entry. One lock guards both. */
+struct lru_attr {
+	struct list_node recency;
+	struct list_node *bucket;
+	uint32_t bucket_count;
+	uint32_t capacity;
+	volatile uint32_t length;
+	semilock_t lock;
+	unsigned int initialized;
 };
 
 struct mem_attr {
@@ -134,6 +388,13 @@ struct mem_info_attr {
 
 
 
+/* Visitor of lib_list__for_each and predicate of lib_list__find_if, a
+ * non-zero return stops the walk */
+typedef int (*list_visit_t)(struct list_node *_node, void *_ctx);
+
+/* Eviction callback of the LRU cache, called outside of the critical section */
+typedef void (*lru_evict_t)(struct lru_node *_node, void *_ctx);
+
 typedef struct mem_attr mem_hdl_t;
 
 typedef struct mem_info_attr *queue_mem_hdl_t;
@@ -0,0 +1,219 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef SH_LOCK_MCS_H_
+#define SH_LOCK_MCS_H_
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+
+/* system */
+#include <string.h>
+#include <sched.h>
+
+/* own libs */
+#include <lib_convention__errno.h>
+
+/* project */
+#include "lib_list_types.h"
+#include "lock_mcs_types.h"
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+#ifndef M_LOCK_MCS__SPIN_COUNT
+	#define M_LOCK_MCS__SPIN_COUNT			10000
+#endif
+
+/* *******************************************************************
+ * Static Inline Functions
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a semilock object - MCS queue lock
+ *
+ * The waiting contexts are queued in arrival order. Each context spins on the
+ * "locked" flag of its own node, the lock holder hands the lock over by
+ * clearing the flag of its successor. Only the node of the successor is
+ * written, the waiters do not compete for a shared cache line.
+ *
+ * \param	*_lock [out]		The semilock_t data type will be initialized
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * ****************************************************************************/
+static inline int mcslock__init(semilock_t *_lock)
+{
+	if(_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	memset((void*)_lock, 0, sizeof(semilock_t));
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Lock of the semilock object - MCS queue lock
+ *
+ *	The contexed_id's are sequential number defined between the range of
+ *		(0 <= _context_id < M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *	A context id must not be used by two contexts at the same time.
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to check if section
+ *							is already entered
+ *			_context_id		Sequential number of the calling context
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * ****************************************************************************/
+static inline int mcslock__lock(semilock_t *_lock, uint32_t _context_id)
+{
+	int i;
+	uint32_t prev;
+	struct mcs_node *node;
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	/*Check if the passed context ID is greater than the number of defined contexts */
+	if(_context_id >= M_DEV_NUMBER_OF_LOCK_CONTEXT) {
+		return -LIB_LIST__ESTD_FAULT;
+	}
+
+	node = &_lock->node[_context_id];
+	node->next = 0;
+	node->locked = 1;
+
+	prev = __atomic_exchange_n(&_lock->tail, _context_id + 1, __ATOMIC_ACQ_REL);
+	if (prev == 0) {
+		return LIB_LIST__EOK;
+	}
+
+	__atomic_store_n(&_lock->node[prev - 1].next, _context_id + 1, __ATOMIC_RELEASE);
+	while (1) {
+		for (i = 0; i < M_LOCK_MCS__SPIN_COUNT; i++) {
+			if (__atomic_load_n(&node->locked, __ATOMIC_ACQUIRE) == 0) {
+				return LIB_LIST__EOK;
+			}
+			M_LIB_LIST__RELAX();
+		}
+		sched_yield();
+	}
+}
+
+/* ************************************************************************//**
+ * \brief	Unlock of the semilock object - MCS queue lock
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to signalizes that a section
+ * 							is left
+ *			_context_id		Sequential number of the calling context
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * ****************************************************************************/
+static inline int mcslock__unlock(semilock_t *_lock, uint32_t _context_id)
+{
+	uint32_t next, tail, i;
+	struct mcs_node *node;
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	/*Check if the passed context ID is greater than the number of defined contexts */
+	if(_context_id >= M_DEV_NUMBER_OF_LOCK_CONTEXT) {
+		return -LIB_LIST__ESTD_FAULT;
+	}
+
+	node = &_lock->node[_context_id];
+	next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+	if (next == 0) {
+		/* No successor known, release the lock if no one queued meanwhile */
+		tail = _context_id + 1;
+		if (__atomic_compare_exchange_n(&_lock->tail, &tail, 0, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+			return LIB_LIST__EOK;
+		}
+
+		/* A successor swapped the tail, wait until it is linked. It may have
+		 * been preempted in between, so the processor is yielded as well. */
+		while (1) {
+			for (i = 0; i < M_LOCK_MCS__SPIN_COUNT; i++) {
+				next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+				if (next != 0) {
+					break;
+				}
+				M_LIB_LIST__RELAX();
+			}
+			if (next != 0) {
+				break;
+			}
+			sched_yield();
+		}
+	}
+
+	__atomic_store_n(&_lock->node[next - 1].locked, 0, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Trylock of the semilock object - MCS queue lock
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to check if section
+ * 							is already entered
+ *			_context_id		Sequential number of the calling context
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_BUSY		: Critical section is already entered by other context
+ * ****************************************************************************/
+static inline int mcslock__trylock(semilock_t *_lock, uint32_t _context_id)
+{
+	uint32_t tail = 0;
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	/*Check if the passed context ID is greater than the number of defined contexts */
+	if(_context_id >= M_DEV_NUMBER_OF_LOCK_CONTEXT) {
+		return -LIB_LIST__ESTD_FAULT;
+	}
+
+	_lock->node[_context_id].next = 0;
+	if (__atomic_compare_exchange_n(&_lock->tail, &tail, _context_id + 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+		return LIB_LIST__EOK;
+	}
+	return -LIB_LIST__ESTD_BUSY;
+}
+
+#endif /* SH_LOCK_MCS_H_ */
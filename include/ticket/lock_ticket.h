@@ -0,0 +1,172 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef SH_LOCK_TICKET_H_
+#define SH_LOCK_TICKET_H_
+
+/* *******************************************************************
+ * includes
+ * ******************************************************************/
+
+/* system */
+#include <string.h>
+#include <sched.h>
+
+/* own libs */
+#include <lib_convention__errno.h>
+
+/* project */
+#include "lib_list_types.h"
+#include "lock_ticket_types.h"
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+
+/* Relax iterations per waiter ahead in the queue between two polls */
+#ifndef M_LOCK_TICKET__BACKOFF
+	#define M_LOCK_TICKET__BACKOFF			64
+#endif
+
+/* Relax iterations after which the waiting context yields the processor */
+#ifndef M_LOCK_TICKET__SPIN_COUNT
+	#define M_LOCK_TICKET__SPIN_COUNT		10000
+#endif
+
+/* Waiters more than this number of tickets behind yield after each backoff,
+ * the contexts ahead of them get the processor if it is oversubscribed */
+#ifndef M_LOCK_TICKET__YIELD_DISTANCE
+	#define M_LOCK_TICKET__YIELD_DISTANCE	1
+#endif
+
+/* *******************************************************************
+ * Static Inline Functions
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a semilock object - Ticket lock
+ *
+ * A context entering draws a ticket and waits until it is served, the
+ * critical section is entered in FIFO order. A waiter polls with a backoff
+ * proportional to its distance to the served ticket, the waiter next in
+ * turn polls most frequently.
+ *
+ * \param	*_lock [out]		The semilock_t data type will be initialized
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * ****************************************************************************/
+static inline int ticketlock__init(semilock_t *_lock)
+{
+	if(_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	memset((void*)_lock, 0, sizeof(semilock_t));
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Lock of the semilock object - Ticket lock
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to check if section
+ * 							is already entered
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * ****************************************************************************/
+static inline int ticketlock__lock(semilock_t *_lock)
+{
+	uint32_t ticket, serving, delay, spin = 0;
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ticket = __atomic_fetch_add(&_lock->next, 1, __ATOMIC_RELAXED);
+	while (1) {
+		serving = __atomic_load_n(&_lock->serving, __ATOMIC_ACQUIRE);
+		if (serving == ticket) {
+			return LIB_LIST__EOK;
+		}
+
+		for (delay = (ticket - serving) * M_LOCK_TICKET__BACKOFF; delay > 0; delay--) {
+			M_LIB_LIST__RELAX();
+		}
+
+		spin += (ticket - serving) * M_LOCK_TICKET__BACKOFF;
+		if ((spin >= M_LOCK_TICKET__SPIN_COUNT) || ((ticket - serving) > M_LOCK_TICKET__YIELD_DISTANCE)) {
+			spin = 0;
+			sched_yield();
+		}
+	}
+}
+
+/* ************************************************************************//**
+ * \brief	Unlock of the semilock object - Ticket lock
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to signalizes that a section
+ * 							is left
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * ****************************************************************************/
+static inline int ticketlock__unlock(semilock_t *_lock)
+{
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	/* Only the holder writes "serving" */
+	__atomic_store_n(&_lock->serving, _lock->serving + 1, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Trylock of the semilock object - Ticket lock
+ *
+ * A ticket is only drawn if it is served at once.
+ *
+ * \param	*_lock [in]	 	The semilock_t data type to check if section
+ * 							is already entered
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_BUSY		: Critical section is already entered by other context
+ * ****************************************************************************/
+static inline int ticketlock__trylock(semilock_t *_lock)
+{
+	uint32_t ticket;
+
+	if (_lock == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ticket = __atomic_load_n(&_lock->serving, __ATOMIC_RELAXED);
+	if (__atomic_compare_exchange_n(&_lock->next, &ticket, ticket + 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+		return LIB_LIST__EOK;
+	}
+	return -LIB_LIST__ESTD_BUSY;
+}
+
+#endif /* SH_LOCK_TICKET_H_ */
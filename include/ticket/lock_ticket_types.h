@@ -0,0 +1,60 @@
+/*
+ * This file is part of the EMBTOM project
+ * Copyright (c) 2018-2020 Thomas Willetal 
+ * (https://github.com/embtom)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef	_LOCK_TICKET_TYPES_H_
+#define _LOCK_TICKET_TYPES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* *******************************************************************
+ * defines
+ * ******************************************************************/
+#ifndef M_LIB_LIST__CACHE_LINE_SIZE
+	#define M_LIB_LIST__CACHE_LINE_SIZE			64
+#endif
+
+/* *******************************************************************
+ * custom data types (e.g. enumerations, structures, unions)
+ * ******************************************************************/
+
+/* Ticket lock, "next" is the next ticket to draw and "serving" the ticket
+ * allowed to enter. Both counters are placed on cache lines of their own,
+ * drawing a ticket does not disturb the waiters polling "serving". */
+struct semilock {
+	volatile uint32_t next;
+	uint8_t next_pad[M_LIB_LIST__CACHE_LINE_SIZE - sizeof(uint32_t)];
+	volatile uint32_t serving;
+	uint8_t serving_pad[M_LIB_LIST__CACHE_LINE_SIZE - sizeof(uint32_t)];
+} __attribute__((aligned(M_LIB_LIST__CACHE_LINE_SIZE)));
+
+typedef struct semilock semilock_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LOCK_TICKET_TYPES_H_ */
@@ -34,6 +34,7 @@
 	#include <stdlib.h>
 	#include <stddef.h>
 	#include <errno.h>
+	#include <limits.h>
 
 /* frame */
 	#include <lib_convention__errno.h>
@@ -43,6 +44,15 @@
 	#include <linux/kernel.h>
 #endif
 
+/* system */
+#if defined(__linux__) && !defined(__KERNEL__)
+	#include <time.h>
+	#include <unistd.h>
+	#include <sys/syscall.h>
+	#include <linux/futex.h>
+	#define CONFIG_LIST__FUTEX_WAIT
+#endif
+
 /* project */
 #include "lib_list.h"
 
@@ -52,6 +62,14 @@
  * ******************************************************************/
 #undef CONFIG_LIST__LOCK_TYPE_SUCCESS
 
+#ifdef CONFIG_LIST__LOCK_TYPE_ATOMIC
+	#include "lock_atomic.h"
+	#define LIB_LIST_CRITICAL_SECTION__INIT(_param) 					atomiclock__init(&_param);
+	#define LIB_LIST_CRITICAL_SECTION__LOCK(_param, _context_id)		atomiclock__lock(&_param, _context_id);
+	#define LIB_LIST_CRITICAL_SECTION__UNLOCK(_param, _context_id)		atomiclock__unlock(&_param, _context_id);
+	#define CONFIG_LIST__LOCK_TYPE_SUCCESS
+#endif
+
 #ifdef CONFIG_LIST__LOCK_TYPE_CAS
 	#include "lock_cas.h"
 	#define LIB_LIST_CRITICAL_SECTION__INIT(_param) 					spinlock__init(&_param);
@@ -60,6 +78,14 @@
 	#define CONFIG_LIST__LOCK_TYPE_SUCCESS
 #endif
 
+#ifdef CONFIG_LIST__LOCK_TYPE_FUTEX
+	#include "lock_futex.h"
+	#define LIB_LIST_CRITICAL_SECTION__INIT(_param) 					futexlock__init(&_param);
+	#define LIB_LIST_CRITICAL_SECTION__LOCK(_param, _context_id)		futexlock__lock(&_param);
+	#define LIB_LIST_CRITICAL_SECTION__UNLOCK(_param, _context_id)		futexlock__unlock(&_param);
+	#define CONFIG_LIST__LOCK_TYPE_SUCCESS
+#endif
+
 #ifdef CONFIG_LIST__LOCK_TYPE_MEM
 	#include "lock_mem.h"
 	#define LIB_LIST_CRITICAL_SECTION__INIT(_param) 					memlock__init(&_param);
@@ -68,6 +94,14 @@
 	#define CONFIG_LIST__LOCK_TYPE_SUCCESS
 #endif
 
+#ifdef CONFIG_LIST__LOCK_TYPE_MCS
+	#include "lock_mcs.h"
+	#define LIB_LIST_CRITICAL_SECTION__INIT(_param) 					mcslock__init(&_param);
+	#define LIB_LIST_CRITICAL_SECTION__LOCK(_param, _context_id)		mcslock__lock(&_param, _context_id);
+	#define LIB_LIST_CRITICAL_SECTION__UNLOCK(_param, _context_id)		mcslock__unlock(&_param, _context_id);
+	#define CONFIG_LIST__LOCK_TYPE_SUCCESS
+#endif
+
 #ifdef CONFIG_LIST__LOCK_TYPE_MTX
 	#include <lib_thread.h>
 	#define LIB_LIST_CRITICAL_SECTION__INIT(_param) 					lib_thread__mutex_init(&_param);
@@ -76,6 +110,22 @@
 	#define CONFIG_LIST__LOCK_TYPE_SUCCESS
 #endif
 
+#ifdef CONFIG_LIST__LOCK_TYPE_TICKET
+	#include "lock_ticket.h"
+	#define LIB_LIST_CRITICAL_SECTION__INIT(_param) 					ticketlock__init(&_param);
+	#define LIB_LIST_CRITICAL_SECTION__LOCK(_param, _context_id)		ticketlock__lock(&_param);
+	#define LIB_LIST_CRITICAL_SECTION__UNLOCK(_param, _context_id)		ticketlock__unlock(&_param);
+	#define CONFIG_LIST__LOCK_TYPE_SUCCESS
+#endif
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	#include "lock_free.h"
+	#define LIB_LIST_CRITICAL_SECTION__INIT(_param)						lockfree__init(&_param);
+	#define LIB_LIST_CRITICAL_SECTION__LOCK(_param, _context_id)		lockfree__lock(&_param);
+	#define LIB_LIST_CRITICAL_SECTION__UNLOCK(_param, _context_id)		lockfree__unlock(&_param);
+	#define CONFIG_LIST__LOCK_TYPE_SUCCESS
+#endif
+
 #ifdef CONFIG_LIST__LOCK_TYPE_FREERTOS
 	#include "lock_freertos.h"
 	#define LIB_LIST_CRITICAL_SECTION__INIT(_param)						freertos_lock__init(&_param);
@@ -202,273 +252,2382 @@ static inline unsigned int list_equal(struct list_node *_node_one, struct list_n
 		return 0;
 }
 
-/* *******************************************************************
- * Static Inline Functions - MEM HANDLING
- * ******************************************************************/
-static inline void mem_lock_type(uint32_t *_lock_table, uint32_t _lock_start, uint32_t _lock_count, uint32_t _lock_type) {
-	unsigned int count;
-	for (count = 0; count < _lock_count; count++) {
-		_lock_table[_lock_start + count] = _lock_type;
-	}
+static inline void list_init(struct list_node *_head, void *_base)
+{
+	_head->next = _head->prev = (struct list_node*)addr_to_virt(_base, _head);
 }
 
-static inline unsigned int mem_check_free_block(uint32_t *_lock_table, uint32_t _check_start, uint32_t _check_count) {
-	unsigned int iterator_check_count, ret = 0;
-	for(iterator_check_count = 0; iterator_check_count < _check_count; iterator_check_count++) {
-		ret += _lock_table[_check_start + iterator_check_count];
+/* Move all nodes of "_list" behind the last node of "_head", "_list" is left empty */
+static inline void list_splice(struct list_node *_list, struct list_node *_head, void *_base)
+{
+	struct list_node *first, *last, *head_last;
+
+	if (list_emty(_list, _base)) {
+		return;
 	}
-	return (ret > 0) ? 1 : 0;
- }
 
-static inline int mem_find_next_free_block(uint32_t *_lock_table, uint32_t _entry_count, uint32_t _get_pos, uint32_t _get_count) {
-	unsigned int ret, iterator_entry_count;
+	first = (struct list_node*)addr_to_phys(_base, _list->prev);
+	last = (struct list_node*)addr_to_phys(_base, _list->next);
+	head_last = (struct list_node*)addr_to_phys(_base, _head->next);
+
+	head_last->prev = _list->prev;
+	first->next = _head->next;
+	last->prev = (struct list_node*)addr_to_virt(_base, _head);
+	_head->next = _list->next;
+
+	list_init(_list, _base);
+}
 
-	uint32_t temp_pos;
+/* Owner tagging of a node, "_queue" NULL marks the node as not linked. Without
+ * CONFIG_LIST__NODE_OWNER the owner is not recorded */
+static inline void node_owner_set(struct list_node *_node, struct queue_attr *_queue, void *_base)
+{
+#ifdef CONFIG_LIST__NODE_OWNER
+	uintptr_t owner;
+	owner = (_queue == NULL) ? 0 : ((uintptr_t)addr_to_virt(_base, _queue) | 1);
+	__atomic_store_n(&_node->owner, owner, __ATOMIC_RELAXED);
+#endif
+}
 
-	for (iterator_entry_count = 0; iterator_entry_count < _entry_count; iterator_entry_count++) {
+#ifdef CONFIG_LIST__NODE_OWNER
+static inline int node_owner_is(struct list_node *_node, struct queue_attr *_queue, void *_base)
+{
+	return (__atomic_load_n(&_node->owner, __ATOMIC_RELAXED) == ((uintptr_t)addr_to_virt(_base, _queue) | 1)) ? 1 : 0;
+}
+#endif
 
-		temp_pos = (_get_pos + iterator_entry_count) % _entry_count;
-		ret = mem_check_free_block(_lock_table, temp_pos, _get_count);
-		if(ret == 0)
-			return temp_pos;
+/* Owner tagging of all nodes of a list, O(n) with CONFIG_LIST__NODE_OWNER */
+static inline void list_owner_set(struct list_node *_head, struct queue_attr *_queue, void *_base)
+{
+#ifdef CONFIG_LIST__NODE_OWNER
+	struct list_node *node;
+	for (node = list_next(_head, _base); !list_equal(node, _head); node = list_next(node, _base)) {
+		node_owner_set(node, _queue, _base);
 	}
-	return -LIB_LIST__ENOSPC;
+#endif
+}
 
+/* Length update of a queue, called within the critical section. The store is
+ * atomic to allow a lock-free read by lib_list__count_relaxed */
+static inline void queue_length_add(struct queue_attr *_queue, int _count)
+{
+	__atomic_store_n(&_queue->length, _queue->length + _count, __ATOMIC_RELAXED);
 }
 
 /* *******************************************************************
- * Global Functions - QUEUE HANDLING
+ * Static Inline Functions - QUEUE WAITING
  * ******************************************************************/
+#ifdef CONFIG_LIST__FUTEX_WAIT
+/* Non private futex operations, the word may be shared between processes */
+static inline int futex_wait(volatile uint32_t *_word, uint32_t _expected, const struct timespec *_timeout)
+{
+	return syscall(SYS_futex, _word, FUTEX_WAIT, _expected, _timeout, NULL, 0);
+}
 
-/* ************************************************************************//**
- * \brief	Initialization of the icb_fifo list
- *
- * \param	*_queue [in]		Initialization of the fifo description attribute
- *
- * \return 	EOK if successful, or negative errno value on error
- * 			-EPAR_NULL		NULL pointer check
- * ****************************************************************************/
-int lib_list__init(struct queue_attr *_queue, void *_base)
+static inline int futex_wake(volatile uint32_t *_word, int _count)
 {
-	int ret;
-	if (_queue == NULL) {
-		return -LIB_LIST__EPAR_NULL;
-	}
+	return syscall(SYS_futex, _word, FUTEX_WAKE, _count, NULL, NULL, 0);
+}
+#endif
 
-	ret = LIB_LIST_CRITICAL_SECTION__INIT(_queue->lock);
-	if(ret < LIB_LIST__EOK) {
-		return ret;
+/* Wake up one context blocked at the wait condition. The syscall is only
+ * issued if a waiter is registered */
+static inline void queue_signal(struct queue_wait *_wait)
+{
+#ifdef CONFIG_LIST__FUTEX_WAIT
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&_wait->waiters, __ATOMIC_RELAXED) == 0) {
+		return;
 	}
 
-
-	_queue->head.next = _queue->head.prev = (struct list_node*)addr_to_virt(_base, (void*)&_queue->head);
-	_queue->initialized = M_CMP_INITIALIZED;
-	return LIB_LIST__EOK;
+	__atomic_fetch_add(&_wait->event, 1, __ATOMIC_SEQ_CST);
+	futex_wake(&_wait->event, 1);
+#endif
 }
 
-/* ************************************************************************//**
- * \brief	Enqueue of a list element
- *
- * \param	*_queue [in]		fifo description attribute, to enqueue
- * \param	*_new [in]			new entry for the list
- * \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *
- * \return 	EOK if successful, or negative errno value on error
- * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
- * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
- * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * ****************************************************************************/
-int lib_list__enqueue(struct queue_attr *_queue, struct list_node * _new, uint32_t _context_id, void *_base)
+#ifdef CONFIG_LIST__FUTEX_WAIT
+static inline void queue_wait_deadline(struct timespec *_deadline, int _timeout_ms)
 {
-	int ret;
-	if(_queue == NULL) {
-		return -LIB_LIST__EPAR_NULL;
+	clock_gettime(CLOCK_MONOTONIC, _deadline);
+	_deadline->tv_sec += _timeout_ms / 1000;
+	_deadline->tv_nsec += (long)(_timeout_ms % 1000) * 1000000L;
+	if (_deadline->tv_nsec >= 1000000000L) {
+		_deadline->tv_sec++;
+		_deadline->tv_nsec -= 1000000000L;
 	}
+}
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
-		return -LIB_LIST__EEXEC_NOINIT;
+/* Sleep as long as the event word is unchanged. Returns -ESTD_AGAIN if the
+ * deadline has passed, a negative timeout waits infinitely */
+static inline int queue_wait_event(struct queue_wait *_wait, uint32_t _event, int _timeout_ms, const struct timespec *_deadline)
+{
+	long remain_ns;
+	struct timespec now, timeout;
+
+	if (_timeout_ms < 0) {
+		futex_wait(&_wait->event, _event, NULL);
+		return LIB_LIST__EOK;
 	}
 
-	/* Lock critical section */
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
-	if(ret < LIB_LIST__EOK) {
-		return ret;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	remain_ns = (_deadline->tv_sec - now.tv_sec) * 1000000000L + (_deadline->tv_nsec - now.tv_nsec);
+	if (remain_ns <= 0) {
+		return -LIB_LIST__ESTD_AGAIN;
 	}
 
-	/* Enqueue list element */
-	list_add_prev(_new,&_queue->head,_base);
-	/*return value check at the unlock functions is not necessary, because check is already passed at the lock functions */
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	timeout.tv_sec = remain_ns / 1000000000L;
+	timeout.tv_nsec = remain_ns % 1000000000L;
+	futex_wait(&_wait->event, _event, &timeout);
 	return LIB_LIST__EOK;
 }
+#endif
 
-/* ************************************************************************//**
- * \brief	Dequeue of a list element
- *
- *  \param	*_queue [in]		 fifo description attribute, to dequeue
- *	\param  **_dequeue_node[out] pointer to dequeue a list element
- *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *
- *	\return EOK if successful, or negative errno value on error
- * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
- * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
- * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
- *
- * ****************************************************************************/
-int lib_list__dequeue(struct queue_attr *_queue, struct list_node **_dequeue_node, uint32_t _context_id, void *_base)
+static inline int queue_is_full(struct queue_attr *_queue)
 {
-	int ret;
-	struct list_node *dequeue_node;
-
-	if ((_queue == NULL) || (_dequeue_node == NULL)) {
-		return -LIB_LIST__EPAR_NULL;
-	}
+	return ((_queue->capacity != 0) && (_queue->length >= _queue->capacity)) ? 1 : 0;
+}
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
-		return -LIB_LIST__EEXEC_NOINIT;
-	}
+/* Lock-free reservation of "_count" entries of the queue length, fails if the
+ * capacity of a bounded queue would be exceeded. Returns the length before
+ * the reservation, so the caller can detect the transition from empty. */
+static inline int queue_length_reserve(struct queue_attr *_queue, unsigned int _count)
+{
+	uint32_t length;
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
-	if (ret < LIB_LIST__EOK) {
-		return ret;
+	if (_queue->capacity == 0) {
+		return (int)__atomic_fetch_add(&_queue->length, _count, __ATOMIC_RELAXED);
 	}
 
-	/*return value check at the unlock functions is not necessary, because check is already passed at the lock functions */
-	if(list_emty(&_queue->head,_base)) {
-		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-		return -LIB_LIST__ESTD_AGAIN;
-	}
+	length = __atomic_load_n(&_queue->length, __ATOMIC_RELAXED);
+	do {
+		if ((length + _count) > _queue->capacity) {
+			return -LIB_LIST__ENOSPC;
+		}
+	} while (!__atomic_compare_exchange_n(&_queue->length, &length, length + _count, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
 
-	dequeue_node = (struct list_node*)addr_to_phys(_base, _queue->head.prev);
-	list_del(dequeue_node, _base);
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-	*_dequeue_node = dequeue_node;
-	return LIB_LIST__EOK;
+	return (int)length;
 }
 
-/* ************************************************************************//**
- * \brief	Get first node
- *
- *  \param	*_queue [in]		 fifo description attribute, to dequeue
- *	\param  **_first_node[out]   pointer to first list element
- *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *
- *	\return EOK if successful, or negative errno value on error
- * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
- * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
- * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
- *
- * ****************************************************************************/
-int lib_list__get_begin(struct queue_attr *_queue, struct list_node ** _begin_node, uint32_t _context_id, void *_base)
+/* *******************************************************************
+ * Static Inline Functions - QUEUE LOCKING
+ * ******************************************************************/
+
+/* Lock of two queues, always in address order to prevent a deadlock */
+static inline int queue_lock_pair(struct queue_attr *_queue_one, struct queue_attr *_queue_two, uint32_t _context_id)
 {
 	int ret;
+	struct queue_attr *first, *second;
 
-	if ((_queue == NULL) || (_begin_node == NULL)) {
-		return -LIB_LIST__EPAR_NULL;
-	}
-
-	if(_queue->initialized != M_CMP_INITIALIZED) {
-		return -LIB_LIST__EEXEC_NOINIT;
-	}
+	first = ((uintptr_t)_queue_one < (uintptr_t)_queue_two) ? _queue_one : _queue_two;
+	second = ((uintptr_t)_queue_one < (uintptr_t)_queue_two) ? _queue_two : _queue_one;
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(first->lock,_context_id);
 	if (ret < LIB_LIST__EOK) {
 		return ret;
 	}
 
-	/*return value check at the unlock functions is not necessary, because check is already passed at the lock functions */
-	if(list_emty(&_queue->head,_base)) {
-		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-		return -LIB_LIST__ESTD_AGAIN;
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(second->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(first->lock,_context_id);
+		return ret;
 	}
-
-	*_begin_node = (struct list_node*)addr_to_phys(_base, _queue->head.prev);
-
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
 	return LIB_LIST__EOK;
 }
 
-/* ************************************************************************//**
- * \brief	Get last node
- *
- *  \param	*_queue [in]		 fifo description attribute, to dequeue
- *	\param  **_first_node[out]   pointer to first list element
- *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+static inline void queue_unlock_pair(struct queue_attr *_queue_one, struct queue_attr *_queue_two, uint32_t _context_id)
+{
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue_one->lock,_context_id);
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue_two->lock,_context_id);
+}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+/* *******************************************************************
+ * Static Inline Functions - LOCK FREE QUEUE HANDLING
  *
- *	\return EOK if successful, or negative errno value on error
- * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
- * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
- * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
+ * Michael-Scott queue on top of the "next" word of the list nodes.
+ * The "head" node of the queue_attr is used as stub node. A dequeued
+ * node leaves the queue completely, if it is the last one the stub is
+ * linked behind it first. Any dequeuer can link the stub, so a preempted
+ * one never blocks the others. The "prev" word of the nodes is not used.
  *
- * ****************************************************************************/
-int lib_list__get_end(struct queue_attr *_queue, struct list_node ** _end_node, uint32_t _context_id, void *_base)
+ * Nodes have to stay mapped after a dequeue (e.g. pool memory of
+ * lib_list__mem_alloc), because a concurrent dequeue may still read
+ * their link word before its compare-and-swap fails.
+ * ******************************************************************/
+static inline volatile uint64_t* lf_link(struct list_node *_node)
 {
-	int ret;
-
-	if ((_queue == NULL) || (_end_node == NULL)) {
-		return -LIB_LIST__EPAR_NULL;
-	}
+	return (volatile uint64_t*)&_node->next;
+}
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
-		return -LIB_LIST__EEXEC_NOINIT;
-	}
+static inline uint64_t lf_offset(struct list_node *_node, void *_base)
+{
+	return (uint64_t)(uintptr_t)addr_to_virt(_base, _node);
+}
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
-	if (ret < LIB_LIST__EOK) {
-		return ret;
-	}
+static inline struct list_node* lf_node(uint64_t _tagged, void *_base)
+{
+	return (struct list_node*)addr_to_phys(_base, (void*)(uintptr_t)lockfree__tag_offset(_tagged));
+}
 
-	/*return value check at the unlock functions is not necessary, because check is already passed at the lock functions */
-	if(list_emty(&_queue->head,_base)) {
-		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-		return -LIB_LIST__ESTD_AGAIN;
-	}
+static inline uint64_t lf_advance(uint64_t _tagged, uint64_t _offset)
+{
+	return lockfree__tag_make(_offset, lockfree__tag_count(_tagged) + 1);
+}
 
-	*_end_node = (struct list_node*)addr_to_phys(_base, _queue->head.next);
-	//*_end_node = &_queue->head;
+static inline void lf_init(struct queue_attr *_queue, void *_base)
+{
+	uint64_t stub = lockfree__tag_make(lf_offset(&_queue->head, _base), 0);
 
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-	return LIB_LIST__EOK;
+	*lf_link(&_queue->head) = lockfree__tag_make(M_LOCKFREE_NIL, 0);
+	_queue->head.prev = NULL;
+	_queue->lock.head = stub;
+	_queue->lock.tail = stub;
+	__sync_synchronize();
 }
 
-/* ************************************************************************//**
- * \brief	Get next node
- *
- *  \param	*_queue [in]		 fifo description attribute, to dequeue
- *	\param  **_first_node[out]   pointer to next list element
- *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *
- *	\return EOK if successful, or negative errno value on error
- * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
- * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
- * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
- *
- * ****************************************************************************/
-int lib_list__get_next(struct queue_attr *_queue, struct list_node ** _next_node, uint32_t _context_id, void *_base)
+/* Link the stub behind "_last", the only node of the queue. "_stub_link" is
+ * the link word of the stub, read while "_last" was still linked to "_link".
+ * A stub detached before still refers to its former successor, it is reset
+ * first. Both steps are compare-and-swap operations on words read before, so
+ * of all dequeuers trying it concurrently only one links the stub. */
+static inline void lf_link_stub(struct queue_attr *_queue, uint64_t _tail, struct list_node *_last, uint64_t _link, uint64_t _stub_link, void *_base)
 {
-	int ret;
-	struct list_node *current_node, *next_node;
-
-	if ((_queue == NULL) || (_next_node == NULL)) {
-		return -LIB_LIST__EPAR_NULL;
-	}
+	uint64_t stub_offset = lf_offset(&_queue->head, _base);
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
-		return -LIB_LIST__EEXEC_NOINIT;
+	if (!lockfree__cas(lf_link(&_queue->head), _stub_link, lf_advance(_stub_link, M_LOCKFREE_NIL))) {
+		return;
 	}
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
-	if (ret < LIB_LIST__EOK) {
-		return ret;
+	if (lockfree__cas(lf_link(_last), _link, lf_advance(_link, stub_offset))) {
+		lockfree__cas(&_queue->lock.tail, _tail, lf_advance(_tail, stub_offset));
+	}
+}
+
+/* The length of the queue has to be reserved by the caller before, so a
+ * concurrent dequeue never underflows it */
+static inline void lf_enqueue_chain(struct queue_attr *_queue, struct list_node *_first, struct list_node *_last, void *_base)
+{
+	uint64_t tail, next, first_offset, last_offset;
+	struct list_node *tail_node;
+
+	first_offset = lf_offset(_first, _base);
+	last_offset = lf_offset(_last, _base);
+	*lf_link(_last) = lf_advance(*lf_link(_last), M_LOCKFREE_NIL);
+
+	while (1) {
+		tail = lockfree__load(&_queue->lock.tail);
+		tail_node = lf_node(tail, _base);
+		next = lockfree__load(lf_link(tail_node));
+		if (tail != lockfree__load(&_queue->lock.tail)) {
+			continue;
+		}
+
+		if (lockfree__tag_offset(next) != M_LOCKFREE_NIL) {
+			/* tail is lagging behind, help to swing it */
+			lockfree__cas(&_queue->lock.tail, tail, lf_advance(tail, lockfree__tag_offset(next)));
+			continue;
+		}
+
+		if (lockfree__cas(lf_link(tail_node), next, lf_advance(next, first_offset))) {
+			/* if it fails, the lagging tail is moved along the chain by the helpers */
+			lockfree__cas(&_queue->lock.tail, tail, lf_advance(tail, last_offset));
+			return;
+		}
+	}
+}
+
+/* Returns the queue length before the enqueue */
+static inline int lf_enqueue(struct queue_attr *_queue, struct list_node *_new, void *_base)
+{
+	int ret;
+
+	ret = queue_length_reserve(_queue, 1);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	lf_enqueue_chain(_queue, _new, _new, _base);
+	return ret;
+}
+
+static inline int lf_dequeue(struct queue_attr *_queue, struct list_node **_dequeue_node, void *_base)
+{
+	uint64_t head, tail, next, stub;
+	uint32_t length;
+	struct list_node *head_node;
+
+	while (1) {
+		head = lockfree__load(&_queue->lock.head);
+		tail = lockfree__load(&_queue->lock.tail);
+		head_node = lf_node(head, _base);
+		next = lockfree__load(lf_link(head_node));
+		if (head != lockfree__load(&_queue->lock.head)) {
+			continue;
+		}
+
+		if (lockfree__tag_offset(head) == lockfree__tag_offset(tail)) {
+			if (lockfree__tag_offset(next) != M_LOCKFREE_NIL) {
+				/* tail is lagging behind, help to swing it */
+				lockfree__cas(&_queue->lock.tail, tail, lf_advance(tail, lockfree__tag_offset(next)));
+				continue;
+			}
+
+			if (list_equal(head_node, &_queue->head)) {
+				return -LIB_LIST__ESTD_AGAIN;
+			}
+
+			/* Last node is at head, link the stub behind it to be able to detach
+			 * it. The stub is read before the link word of the node is confirmed,
+			 * it cannot be part of the queue at this point. */
+			stub = lockfree__load(lf_link(&_queue->head));
+			if (lockfree__load(lf_link(head_node)) == next) {
+				lf_link_stub(_queue, tail, head_node, next, stub, _base);
+			}
+			continue;
+		}
+
+		if (lockfree__tag_offset(next) == M_LOCKFREE_NIL) {
+			continue;
+		}
+
+		if (lockfree__cas(&_queue->lock.head, head, lf_advance(head, lockfree__tag_offset(next)))) {
+			if (list_equal(head_node, &_queue->head)) {
+				continue;
+			}
+			/* Blocked producers are only woken up at the transition from full to non-full */
+			length = __atomic_fetch_sub(&_queue->length, 1, __ATOMIC_RELAXED);
+			if ((_queue->capacity != 0) && (length == _queue->capacity)) {
+				queue_signal(&_queue->not_full);
+			}
+			*_dequeue_node = head_node;
+			return LIB_LIST__EOK;
+		}
+	}
+}
+
+/* Private chain of a lock-free queue, single linked through the tagged link
+ * words like the queue itself. The link word of the chain head refers to the
+ * first node, the last node is linked to M_LOCKFREE_NIL. A node leaves the
+ * chain with its modification counter unchanged, so a later enqueue still
+ * advances it. */
+static inline void lf_chain_init(struct list_node *_chain)
+{
+	*lf_link(_chain) = lockfree__tag_make(M_LOCKFREE_NIL, 0);
+	_chain->prev = NULL;
+}
+
+static inline void lf_chain_add(struct list_node *_chain, struct list_node *_last, struct list_node *_new, void *_base)
+{
+	if (_last == NULL) {
+		*lf_link(_chain) = lockfree__tag_make(lf_offset(_new, _base), 0);
+	}
+	else {
+		*lf_link(_last) = lf_advance(*lf_link(_last), lf_offset(_new, _base));
+	}
+}
+
+static inline int lf_chain_dequeue(struct list_node *_chain, struct list_node **_dequeue_node, void *_base)
+{
+	struct list_node *node;
+
+	if (lockfree__tag_offset(*lf_link(_chain)) == M_LOCKFREE_NIL) {
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	node = lf_node(*lf_link(_chain), _base);
+	*lf_link(_chain) = lockfree__tag_make(lockfree__tag_offset(*lf_link(node)), 0);
+	*_dequeue_node = node;
+	return LIB_LIST__EOK;
+}
+
+static inline int lf_emty(struct queue_attr *_queue, void *_base)
+{
+	uint64_t head, next;
+	struct list_node *head_node;
+
+	head = lockfree__load(&_queue->lock.head);
+	head_node = lf_node(head, _base);
+	if (!list_equal(head_node, &_queue->head)) {
+		return 0;
+	}
+
+	next = lockfree__load(lf_link(head_node));
+	return (lockfree__tag_offset(next) == M_LOCKFREE_NIL) ? 1 : 0;
+}
+#endif
+
+/* *******************************************************************
+ * Static Inline Functions - CHAIN HANDLING
+ *
+ * Private chains are built in the node format of the queue engine, the
+ * format lib_list__chain_dequeue expects. "_last" tracks the last node
+ * of the chain for the single linked lock-free format.
+ * ******************************************************************/
+static inline void chain_init(struct list_node *_chain, void *_base)
+{
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	lf_chain_init(_chain);
+#else
+	list_init(_chain, _base);
+#endif
+}
+
+static inline void chain_add(struct list_node *_chain, struct list_node **_last, struct list_node *_new, void *_base)
+{
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	lf_chain_add(_chain, *_last, _new, _base);
+	*lf_link(_new) = lf_advance(*lf_link(_new), M_LOCKFREE_NIL);
+#else
+	list_add_prev(_new, _chain, _base);
+#endif
+	*_last = _new;
+}
+
+/* *******************************************************************
+ * Static Inline Functions - PRIORITY QUEUE HANDLING
+ * ******************************************************************/
+
+/* Highest non-empty level of a priority queue, "_bitmap" must not be 0 */
+static inline unsigned int prio_highest(uint32_t _bitmap)
+{
+	return (M_LIB_LIST__PRIO_LEVELS - 1) - __builtin_clz(_bitmap);
+}
+
+/* *******************************************************************
+ * Static Inline Functions - SKIP LIST HANDLING
+ * ******************************************************************/
+static inline struct skip_node* skip_index_next(struct skip_node *_node, unsigned int _level, void *_base)
+{
+	return (struct skip_node*)addr_to_phys(_base, _node->index[_level]);
+}
+
+/* Number of index levels of a new node, each level is taken with a
+ * probability of 1/4 (two zero bits of a xorshift random value) */
+static inline uint32_t skip_random_height(struct skip_attr *_skip)
+{
+	uint32_t random, height;
+
+	random = _skip->seed;
+	random ^= random << 13;
+	random ^= random >> 17;
+	random ^= random << 5;
+	_skip->seed = random;
+
+	height = (uint32_t)__builtin_ctz(random | 0x80000000U) / 2;
+	return (height < M_LIB_LIST__SKIP_LEVELS) ? height : M_LIB_LIST__SKIP_LEVELS;
+}
+
+/* Search of the first bottom level node with a key greater than "_key"
+ * ("_after_equal" set) or not less than "_key". The last index node in front
+ * of it is stored at "_update" for every index level in use. */
+static inline struct list_node* skip_search(struct skip_attr *_skip, uint64_t _key, int _after_equal, struct skip_node **_update, void *_base)
+{
+	int level;
+	struct skip_node *pred, *next;
+	struct list_node *node;
+
+	pred = &_skip->head;
+	for (level = (int)_skip->height - 1; level >= 0; level--) {
+		next = skip_index_next(pred, level, _base);
+		while ((next != &_skip->head) && ((next->key < _key) || (_after_equal && (next->key == _key)))) {
+			pred = next;
+			next = skip_index_next(pred, level, _base);
+		}
+		_update[level] = pred;
+	}
+
+	node = list_next(&pred->node, _base);
+	while (!list_equal(node, &_skip->head.node)) {
+		if ((((struct skip_node*)node)->key > _key) || (!_after_equal && (((struct skip_node*)node)->key == _key))) {
+			break;
+		}
+		node = list_next(node, _base);
+	}
+	return node;
+}
+
+/* Drop the index levels which are left empty */
+static inline void skip_shrink(struct skip_attr *_skip, void *_base)
+{
+	while ((_skip->height > 0) && (skip_index_next(&_skip->head, _skip->height - 1, _base) == &_skip->head)) {
+		_skip->height--;
+	}
+}
+
+/* *******************************************************************
+ * Static Inline Functions - TWO LOCK QUEUE HANDLING
+ * ******************************************************************/
+
+/* Link a node behind the tail, called with the tail lock held. The link is
+ * published with release order, the consumer reads it without the tail lock */
+static inline void twolock_link(struct twolock_attr *_queue, struct list_node *_new, void *_base)
+{
+	struct list_node *virt_new, *tail_node;
+
+	virt_new = (struct list_node*)addr_to_virt(_base, _new);
+	_new->next = virt_new;
+	tail_node = (struct list_node*)addr_to_phys(_base, _queue->tail.node);
+	__atomic_store_n(&tail_node->next, virt_new, __ATOMIC_RELEASE);
+	_queue->tail.node = virt_new;
+}
+
+static inline struct list_node* twolock_next(struct list_node *_node, void *_base)
+{
+	return (struct list_node*)addr_to_phys(_base, __atomic_load_n(&_node->next, __ATOMIC_ACQUIRE));
+}
+
+/* *******************************************************************
+ * Static Inline Functions - MPSC QUEUE HANDLING
+ * ******************************************************************/
+
+/* Wait free link of a node: one exchange of the tail, then the predecessor
+ * is linked. Until then the consumer sees the list ending at the predecessor */
+static inline void mpsc_push(struct mpsc_attr *_mpsc, struct list_node *_new, void *_base)
+{
+	struct list_node *virt_new, *prev;
+
+	virt_new = (struct list_node*)addr_to_virt(_base, _new);
+	_new->next = virt_new;
+	prev = (struct list_node*)addr_to_phys(_base, __atomic_exchange_n(&_mpsc->tail, virt_new, __ATOMIC_ACQ_REL));
+	__atomic_store_n(&prev->next, virt_new, __ATOMIC_RELEASE);
+}
+
+/* *******************************************************************
+ * Static Inline Functions - TIMING WHEEL HANDLING
+ * ******************************************************************/
+
+/* Link a timer to its slot. "_from" is the first tick not yet processed,
+ * expired timers are placed at it. Timers beyond the range of the wheel are
+ * parked at the farthest slot of the last level and placed again on cascade */
+static inline void wheel_place(struct wheel_attr *_wheel, struct wheel_timer *_timer, uint64_t _from, void *_base)
+{
+	unsigned int level, index;
+	uint64_t target, delta;
+
+	target = (_timer->expires > _from) ? _timer->expires : _from;
+	delta = target - _from;
+
+	for (level = 0; level < (M_LIB_LIST__WHEEL_LEVELS - 1); level++) {
+		if (delta < ((uint64_t)1 << (M_LIB_LIST__WHEEL_SLOT_BITS * (level + 1)))) {
+			break;
+		}
+	}
+
+	if (delta >= ((uint64_t)1 << (M_LIB_LIST__WHEEL_SLOT_BITS * M_LIB_LIST__WHEEL_LEVELS))) {
+		target = _from + ((uint64_t)1 << (M_LIB_LIST__WHEEL_SLOT_BITS * M_LIB_LIST__WHEEL_LEVELS)) - 1;
+	}
+
+	index = (unsigned int)(target >> (M_LIB_LIST__WHEEL_SLOT_BITS * level)) & (M_LIB_LIST__WHEEL_SLOTS - 1);
+	list_add_prev(&_timer->node, &_wheel->slot[level][index], _base);
+	_wheel->bitmap[level] |= ((uint64_t)1 << index);
+	_timer->pending = 1;
+}
+
+/* Place all timers of a slot of an upper level again, relative to "_from" */
+static inline void wheel_cascade(struct wheel_attr *_wheel, unsigned int _level, unsigned int _index, uint64_t _from, void *_base)
+{
+	struct list_node chain, *node;
+
+	if ((_wheel->bitmap[_level] & ((uint64_t)1 << _index)) == 0) {
+		return;
+	}
+
+	list_init(&chain, _base);
+	list_splice(&_wheel->slot[_level][_index], &chain, _base);
+	_wheel->bitmap[_level] &= ~((uint64_t)1 << _index);
+
+	while (!list_emty(&chain, _base)) {
+		node = list_next(&chain, _base);
+		list_del(node, _base);
+		list_init(node, _base);
+		wheel_place(_wheel, (struct wheel_timer*)node, _from, _base);
+	}
+}
+
+/* Hand the timers of a level 0 slot over to the chain "_expired", they are
+ * not pending anymore and can no longer be cancelled */
+static inline void wheel_expire(struct wheel_attr *_wheel, unsigned int _index, struct list_node *_expired, struct list_node **_last, void *_base)
+{
+	struct list_node *slot, *node;
+
+	slot = &_wheel->slot[0][_index];
+	while (!list_emty(slot, _base)) {
+		node = list_next(slot, _base);
+		list_del(node, _base);
+		list_init(node, _base);
+		((struct wheel_timer*)node)->pending = 0;
+		chain_add(_expired, _last, node, _base);
+	}
+	_wheel->bitmap[0] &= ~((uint64_t)1 << _index);
+}
+
+/* Next tick after "now" with work to do: a level 0 slot to expire or an
+ * upper level slot to cascade. The bitmap of each level is rotated so bit 0
+ * is the first slot reached after "now", its lowest set bit gives the next
+ * occupied slot. The wheel must not be empty. */
+static inline uint64_t wheel_next_tick(struct wheel_attr *_wheel)
+{
+	unsigned int level, shift, index;
+	uint64_t bitmap, first, next, tick = UINT64_MAX;
+
+	for (level = 0; level < M_LIB_LIST__WHEEL_LEVELS; level++) {
+		bitmap = _wheel->bitmap[level];
+		if (bitmap == 0) {
+			continue;
+		}
+
+		shift = M_LIB_LIST__WHEEL_SLOT_BITS * level;
+		first = ((_wheel->now >> shift) + 1) << shift;
+		index = (unsigned int)(first >> shift) & (M_LIB_LIST__WHEEL_SLOTS - 1);
+		if (index != 0) {
+			bitmap = (bitmap >> index) | (bitmap << (M_LIB_LIST__WHEEL_SLOTS - index));
+		}
+
+		next = first + ((uint64_t)__builtin_ctzll(bitmap) << shift);
+		if (next < tick) {
+			tick = next;
+		}
+	}
+	return tick;
+}
+
+static inline int wheel_emty(struct wheel_attr *_wheel)
+{
+	unsigned int level;
+
+	for (level = 0; level < M_LIB_LIST__WHEEL_LEVELS; level++) {
+		if (_wheel->bitmap[level] != 0) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* *******************************************************************
+ * Static Inline Functions - HASH TABLE HANDLING
+ * ******************************************************************/
+
+/* Multiplicative (Fibonacci) hash of a key. The stripe of a key is given by
+ * the low bits, a bucket of any array size therefore stays in its stripe. */
+static inline uint32_t hash_key(uint64_t _key)
+{
+	return (uint32_t)((_key * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+static inline struct list_node* hash_bucket_alloc(uint32_t _bucket_count, uint32_t _context_id, mem_hdl_t *_hdl, int *_ret)
+{
+	uint32_t index, entry_count;
+	struct list_node *bucket;
+
+	entry_count = (_bucket_count * sizeof(struct list_node) + _hdl->entry_size - 1) / _hdl->entry_size;
+	bucket = (struct list_node*)lib_list__mem_alloc(_hdl, entry_count, _context_id, _ret);
+	if (bucket == NULL) {
+		return NULL;
+	}
+
+	for (index = 0; index < _bucket_count; index++) {
+		list_init(&bucket[index], (void*)_hdl->mem_base);
+	}
+	return bucket;
+}
+
+static inline int hash_lock_all(struct hash_attr *_hash, uint32_t _context_id)
+{
+	int ret;
+	unsigned int stripe;
+
+	for (stripe = 0; stripe < M_LIB_LIST__HASH_STRIPES; stripe++) {
+		ret = LIB_LIST_CRITICAL_SECTION__LOCK(_hash->stripe[stripe].lock,_context_id);
+		if (ret < LIB_LIST__EOK) {
+			while (stripe-- > 0) {
+				LIB_LIST_CRITICAL_SECTION__UNLOCK(_hash->stripe[stripe].lock,_context_id);
+			}
+			return ret;
+		}
+	}
+	return LIB_LIST__EOK;
+}
+
+static inline void hash_unlock_all(struct hash_attr *_hash, uint32_t _context_id)
+{
+	unsigned int stripe;
+
+	for (stripe = M_LIB_LIST__HASH_STRIPES; stripe-- > 0;) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_hash->stripe[stripe].lock,_context_id);
+	}
+}
+
+/* Move up to "_steps" old buckets of a stripe to the current array, the lock
+ * of the stripe has to be held. The nodes of an old bucket are older than any
+ * node inserted to the current array, so they are moved to the front of their
+ * new bucket, last node first, to keep the insert order of each key. The old
+ * array is freed by the context completing the last stripe, no other stripe
+ * accesses it anymore then. */
+static inline void hash_migrate(struct hash_attr *_hash, unsigned int _stripe, uint32_t _steps, uint32_t _context_id, mem_hdl_t *_hdl)
+{
+	uint32_t pos;
+	void *base = (void*)_hdl->mem_base;
+	struct list_node *old, *bucket, *node;
+
+	old = __atomic_load_n(&_hash->old_bucket, __ATOMIC_RELAXED);
+	pos = _hash->stripe[_stripe].migrate_pos;
+	if ((old == NULL) || (pos >= _hash->old_count)) {
+		return;
+	}
+
+	old = (struct list_node*)addr_to_phys(base, old);
+	bucket = (struct list_node*)addr_to_phys(base, _hash->bucket);
+	while ((_steps > 0) && (pos < _hash->old_count)) {
+		while (!list_emty(&old[pos], base)) {
+			node = list_priv(&old[pos], base);
+			list_del(node, base);
+			list_add_next(node, &bucket[hash_key(((struct hash_node*)node)->key) & (_hash->bucket_count - 1)], base);
+		}
+		pos += M_LIB_LIST__HASH_STRIPES;
+		_steps--;
+	}
+	_hash->stripe[_stripe].migrate_pos = pos;
+
+	if ((pos >= _hash->old_count) &&
+		(__atomic_add_fetch(&_hash->stripes_done, 1, __ATOMIC_ACQ_REL) == M_LIB_LIST__HASH_STRIPES)) {
+		__atomic_store_n(&_hash->old_bucket, NULL, __ATOMIC_RELEASE);
+		lib_list__mem_free(_hdl, old, _context_id);
+	}
+}
+
+/* Replace the bucket array by one of "_bucket_count" buckets. A pending
+ * migration is completed first. With "_grow" set the resize is dropped if
+ * another context resized the table in the meantime. */
+static inline int hash_resize(struct hash_attr *_hash, uint32_t _bucket_count, int _grow, uint32_t _context_id, mem_hdl_t *_hdl)
+{
+	int ret;
+	unsigned int stripe;
+	struct list_node *bucket;
+
+	bucket = hash_bucket_alloc(_bucket_count, _context_id, _hdl, &ret);
+	if (bucket == NULL) {
+		return ret;
+	}
+
+	ret = hash_lock_all(_hash, _context_id);
+	if (ret < LIB_LIST__EOK) {
+		lib_list__mem_free(_hdl, bucket, _context_id);
+		return ret;
+	}
+
+	if (_grow && ((_hash->old_bucket != NULL) || ((_hash->bucket_count * 2) != _bucket_count))) {
+		hash_unlock_all(_hash, _context_id);
+		lib_list__mem_free(_hdl, bucket, _context_id);
+		return LIB_LIST__EOK;
+	}
+
+	for (stripe = 0; stripe < M_LIB_LIST__HASH_STRIPES; stripe++) {
+		hash_migrate(_hash, stripe, _hash->old_count, _context_id, _hdl);
+	}
+
+	_hash->old_bucket = _hash->bucket;
+	_hash->old_count = _hash->bucket_count;
+	_hash->bucket = (struct list_node*)addr_to_virt((void*)_hdl->mem_base, bucket);
+	_hash->bucket_count = _bucket_count;
+	for (stripe = 0; stripe < M_LIB_LIST__HASH_STRIPES; stripe++) {
+		_hash->stripe[stripe].migrate_pos = stripe;
+	}
+	_hash->stripes_done = 0;
+
+	hash_unlock_all(_hash, _context_id);
+	return LIB_LIST__EOK;
+}
+
+/* *******************************************************************
+ * Static Inline Functions - LRU CACHE HANDLING
+ * ******************************************************************/
+static inline struct lru_node* lru_entry(struct list_node *_recency)
+{
+	return (struct lru_node*)((uint8_t*)_recency - offsetof(struct lru_node, recency));
+}
+
+static inline struct lru_node* lru_search(struct lru_attr *_lru, uint64_t _key, void *_base)
+{
+	struct list_node *bucket, *node;
+
+	bucket = (struct list_node*)addr_to_phys(_base, _lru->bucket) + (hash_key(_key) & (_lru->bucket_count - 1));
+	for (node = list_next(bucket, _base); !list_equal(node, bucket); node = list_next(node, _base)) {
+		if (((struct hash_node*)node)->key == _key) {
+			return (struct lru_node*)node;
+		}
+	}
+	return NULL;
+}
+
+static inline void lru_unlink(struct lru_attr *_lru, struct lru_node *_node, void *_base)
+{
+	list_del(&_node->entry.node, _base);
+	list_del(&_node->recency, _base);
+	__atomic_store_n(&_lru->length, _lru->length - 1, __ATOMIC_RELAXED);
+}
+
+/* Hand the evicted entries to the callback, or back to the memory region
+ * without one */
+static inline void lru_release(struct lru_node **_evicted, unsigned int _count, lru_evict_t _evict, void *_evict_ctx, uint32_t _context_id, mem_hdl_t *_hdl)
+{
+	unsigned int index;
+
+	for (index = 0; index < _count; index++) {
+		if (_evict != NULL) {
+			_evict(_evicted[index], _evict_ctx);
+		}
+		else {
+			lib_list__mem_free(_hdl, _evicted[index], _context_id);
+		}
+	}
+}
+
+/* *******************************************************************
+ * Static Inline Functions - MEM HANDLING
+ * ******************************************************************/
+static inline void mem_lock_type(uint32_t *_lock_table, uint32_t _lock_start, uint32_t _lock_count, uint32_t _lock_type) {
+	unsigned int count;
+	for (count = 0; count < _lock_count; count++) {
+		_lock_table[_lock_start + count] = _lock_type;
+	}
+}
+
+/* Search a block of "_get_count" free entries starting at "_get_pos", then
+ * from the beginning of the table. A locked entry moves the start of the
+ * candidate block behind it, every entry is checked at most twice. */
+static inline int mem_find_next_free_block(uint32_t *_lock_table, uint32_t _entry_count, uint32_t _get_pos, uint32_t _get_count) {
+	uint32_t start, pos, pass;
+
+	if (_get_count == 0) {
+		return (int)_get_pos;
+	}
+
+	for (pass = 0; pass < 2; pass++) {
+		start = (pass == 0) ? _get_pos : 0;
+		pos = start;
+		while ((start + _get_count) <= _entry_count) {
+			if (_lock_table[pos] != 0) {
+				start = pos + 1;
+				pos = start;
+				continue;
+			}
+			if ((++pos - start) == _get_count) {
+				return (int)start;
+			}
+		}
+	}
+	return -LIB_LIST__ENOSPC;
+}
+
+/* *******************************************************************
+ * Global Functions - QUEUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of the icb_fifo list
+ *
+ * \param	*_queue [in]		Initialization of the fifo description attribute
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		NULL pointer check
+ * ****************************************************************************/
+int lib_list__init(struct queue_attr *_queue, void *_base)
+{
+	return lib_list__init_bounded(_queue, 0, _base);
+}
+
+/* ************************************************************************//**
+ * \brief	Initialization of a bounded icb_fifo list
+ *
+ *  A bounded queue refuses to take more than "_capacity" nodes, all inserting
+ *  operations fail with -ENOSPC instead. The fill level is checked by the
+ *  length counter of the queue attribute.
+ *
+ * \param	*_queue [in]		Initialization of the fifo description attribute
+ * \param	_capacity			Maximum number of nodes, 0 for an unbounded queue
+ * \param	*_base[in]			base mem address
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		NULL pointer check
+ * ****************************************************************************/
+int lib_list__init_bounded(struct queue_attr *_queue, unsigned int _capacity, void *_base)
+{
+	int ret;
+	if (_queue == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__INIT(_queue->lock);
+	if(ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	lf_init(_queue, _base);
+#else
+	_queue->head.next = _queue->head.prev = (struct list_node*)addr_to_virt(_base, (void*)&_queue->head);
+#endif
+	_queue->length = 0;
+	_queue->capacity = _capacity;
+	memset(&_queue->not_emty, 0, sizeof(struct queue_wait));
+	memset(&_queue->not_full, 0, sizeof(struct queue_wait));
+	_queue->initialized = M_CMP_INITIALIZED;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element
+ *
+ * \param	*_queue [in]		fifo description attribute, to enqueue
+ * \param	*_new [in]			new entry for the list
+ * \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: Capacity of a bounded queue is reached
+ * ****************************************************************************/
+int lib_list__enqueue(struct queue_attr *_queue, struct list_node * _new, uint32_t _context_id, void *_base)
+{
+	int ret, was_emty;
+	if(_queue == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	if(_new == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ret = lf_enqueue(_queue, _new, _base);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	/* Waiters are only woken up at the transition from empty to non-empty */
+	if (ret == 0) {
+		queue_signal(&_queue->not_emty);
+	}
+	return LIB_LIST__EOK;
+#endif
+
+	/* Lock critical section */
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if(ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	if (queue_is_full(_queue)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ENOSPC;
+	}
+
+	/* Enqueue list element */
+	was_emty = (_queue->length == 0);
+	list_add_prev(_new,&_queue->head,_base);
+	node_owner_set(_new, _queue, _base);
+	queue_length_add(_queue, 1);
+	/*return value check at the unlock functions is not necessary, because check is already passed at the lock functions */
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+
+	/* Waiters are only woken up at the transition from empty to non-empty */
+	if (was_emty) {
+		queue_signal(&_queue->not_emty);
+	}
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element, fail fast if the queue is full
+ *
+ *  The fill level of a bounded queue is checked by a lock-free read of the
+ *  length counter, a full queue is reported without entering the critical
+ *  section.
+ *
+ * \param	*_queue [in]		fifo description attribute, to enqueue
+ * \param	*_new [in]			new entry for the list
+ * \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ * \param	*_base[in]			base mem address
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: Capacity of the queue is reached
+ * ****************************************************************************/
+int lib_list__try_enqueue(struct queue_attr *_queue, struct list_node * _new, uint32_t _context_id, void *_base)
+{
+	if ((_queue == NULL) || (_new == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	if ((_queue->capacity != 0) && (__atomic_load_n(&_queue->length, __ATOMIC_RELAXED) >= _queue->capacity)) {
+		return -LIB_LIST__ENOSPC;
+	}
+
+	return lib_list__enqueue(_queue, _new, _context_id, _base);
+}
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element, blocking while the queue is full
+ *
+ *  The calling context sleeps at a non private futex word of the queue
+ *  attribute until a consumer frees an entry of the bounded queue.
+ *
+ * \param	*_queue [in]		fifo description attribute, to enqueue
+ * \param	*_new [in]			new entry for the list
+ * \param	_timeout_ms			maximum time to wait in milliseconds, negative to wait infinitely
+ * \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ * \param	*_base[in]			base mem address
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: Queue is still full after the timeout
+ * 			-ESTD_NOSYS		: No futex support at the target
+ * ****************************************************************************/
+int lib_list__enqueue_wait(struct queue_attr *_queue, struct list_node * _new, int _timeout_ms, uint32_t _context_id, void *_base)
+{
+#ifdef CONFIG_LIST__FUTEX_WAIT
+	int ret;
+	uint32_t event;
+	struct timespec deadline;
+
+	ret = lib_list__try_enqueue(_queue, _new, _context_id, _base);
+	if ((ret != -LIB_LIST__ENOSPC) || (_timeout_ms == 0)) {
+		return ret;
+	}
+
+	if (_timeout_ms > 0) {
+		queue_wait_deadline(&deadline, _timeout_ms);
+	}
+
+	/* The waiter is registered before the event is sampled and the queue is
+	 * checked again, a dequeue in between changes the event word */
+	__atomic_fetch_add(&_queue->not_full.waiters, 1, __ATOMIC_SEQ_CST);
+	while (1) {
+		event = __atomic_load_n(&_queue->not_full.event, __ATOMIC_SEQ_CST);
+		ret = lib_list__enqueue(_queue, _new, _context_id, _base);
+		if (ret != -LIB_LIST__ENOSPC) {
+			break;
+		}
+
+		if (queue_wait_event(&_queue->not_full, event, _timeout_ms, &deadline) < LIB_LIST__EOK) {
+			break;
+		}
+	}
+	__atomic_fetch_sub(&_queue->not_full.waiters, 1, __ATOMIC_SEQ_CST);
+
+	/* Pass the wake up on, if space is left for further producers */
+	if ((ret == LIB_LIST__EOK) && !queue_is_full(_queue)) {
+		queue_signal(&_queue->not_full);
+	}
+	return ret;
+#else
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+}
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_dequeue_node[out] pointer to dequeue a list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ *
+ * ****************************************************************************/
+int lib_list__dequeue(struct queue_attr *_queue, struct list_node **_dequeue_node, uint32_t _context_id, void *_base)
+{
+	int ret, was_full;
+	struct list_node *dequeue_node;
+
+	if ((_queue == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	return lf_dequeue(_queue, _dequeue_node, _base);
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	/*return value check at the unlock functions is not necessary, because check is already passed at the lock functions */
+	if(list_emty(&_queue->head,_base)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	was_full = queue_is_full(_queue);
+	dequeue_node = (struct list_node*)addr_to_phys(_base, _queue->head.prev);
+	list_del(dequeue_node, _base);
+	node_owner_set(dequeue_node, NULL, _base);
+	queue_length_add(_queue, -1);
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+
+	/* Blocked producers are only woken up at the transition from full to non-full */
+	if (was_full) {
+		queue_signal(&_queue->not_full);
+	}
+	*_dequeue_node = dequeue_node;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Enqueue of several list elements
+ *
+ *  All passed nodes are enqueued in array order within one critical section.
+ *
+ * \param	*_queue [in]		fifo description attribute, to enqueue
+ * \param	**_nodes [in]		array of new entries for the list
+ * \param	_count				number of entries at "_nodes"
+ * \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ * \param	*_base[in]			base mem address
+ *
+ * \return 	EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: Not all nodes fit into a bounded queue, none is enqueued
+ * ****************************************************************************/
+int lib_list__enqueue_bulk(struct queue_attr *_queue, struct list_node **_nodes, unsigned int _count, uint32_t _context_id, void *_base)
+{
+	int ret, was_emty;
+	unsigned int count;
+
+	if ((_queue == NULL) || (_nodes == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	for (count = 0; count < _count; count++) {
+		if (_nodes[count] == NULL) {
+			return -LIB_LIST__EPAR_NULL;
+		}
+	}
+
+	if (_count == 0) {
+		return LIB_LIST__EOK;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	ret = queue_length_reserve(_queue, _count);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+	was_emty = (ret == 0);
+
+	/* Link the nodes privately and publish the whole chain with one swap */
+	for (count = 0; count < _count - 1; count++) {
+		*lf_link(_nodes[count]) = lf_advance(*lf_link(_nodes[count]), lf_offset(_nodes[count + 1], _base));
+	}
+	lf_enqueue_chain(_queue, _nodes[0], _nodes[_count - 1], _base);
+	if (was_emty) {
+		queue_signal(&_queue->not_emty);
+	}
+	return LIB_LIST__EOK;
+#endif
+
+	/* Lock critical section */
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if(ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	if ((_queue->capacity != 0) && ((_queue->length + _count) > _queue->capacity)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ENOSPC;
+	}
+
+	was_emty = (_queue->length == 0);
+	for (count = 0; count < _count; count++) {
+		list_add_prev(_nodes[count],&_queue->head,_base);
+		node_owner_set(_nodes[count], _queue, _base);
+	}
+	queue_length_add(_queue, _count);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+
+	if (was_emty) {
+		queue_signal(&_queue->not_emty);
+	}
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Dequeue of several list elements
+ *
+ *  Up to "_max_count" nodes are dequeued in fifo order within one critical section.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_nodes[out]		 array to store the dequeued list elements
+ *	\param  _max_count			 number of entries at "_nodes", at least one
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return number of dequeued nodes if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EPAR_RANGE		: "_max_count" is zero
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ *
+ * ****************************************************************************/
+int lib_list__dequeue_bulk(struct queue_attr *_queue, struct list_node **_nodes, unsigned int _max_count, uint32_t _context_id, void *_base)
+{
+	int ret, was_full;
+	unsigned int count;
+	struct list_node *dequeue_node;
+
+	if ((_queue == NULL) || (_nodes == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_max_count == 0) {
+		return -LIB_LIST__EPAR_RANGE;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	for (count = 0; count < _max_count; count++) {
+		if (lf_dequeue(_queue, &_nodes[count], _base) < LIB_LIST__EOK) {
+			break;
+		}
+	}
+	return (count > 0) ? (int)count : -LIB_LIST__ESTD_AGAIN;
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	/*return value check at the unlock functions is not necessary, because check is already passed at the lock functions */
+	if(list_emty(&_queue->head,_base)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	was_full = queue_is_full(_queue);
+	for (count = 0; (count < _max_count) && !list_emty(&_queue->head,_base); count++) {
+		dequeue_node = (struct list_node*)addr_to_phys(_base, _queue->head.prev);
+		list_del(dequeue_node, _base);
+		node_owner_set(dequeue_node, NULL, _base);
+		_nodes[count] = dequeue_node;
+	}
+	queue_length_add(_queue, -(int)count);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+
+	if (was_full) {
+		queue_signal(&_queue->not_full);
+	}
+	return count;
+}
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element, blocking while the fifo is empty
+ *
+ *  The calling context sleeps at a futex word inside the queue attribute.
+ *  The futex is not process private, so contexts of different processes
+ *  attached to the same shared segment can wait and wake each other.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_dequeue_node[out] pointer to dequeue a list element
+ *	\param  _timeout_ms			 maximum time to wait in milliseconds, negative to wait infinitely
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is still empty after the timeout
+ * 			-ESTD_NOSYS		: No futex support at the target
+ *
+ * ****************************************************************************/
+int lib_list__dequeue_wait(struct queue_attr *_queue, struct list_node **_dequeue_node, int _timeout_ms, uint32_t _context_id, void *_base)
+{
+#ifdef CONFIG_LIST__FUTEX_WAIT
+	int ret;
+	uint32_t event;
+	struct timespec deadline;
+
+	if ((_queue == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = lib_list__dequeue(_queue, _dequeue_node, _context_id, _base);
+	if ((ret != -LIB_LIST__ESTD_AGAIN) || (_timeout_ms == 0)) {
+		return ret;
+	}
+
+	if (_timeout_ms > 0) {
+		queue_wait_deadline(&deadline, _timeout_ms);
+	}
+
+	/* The waiter is registered before the event is sampled and the queue is
+	 * checked again, an enqueue in between changes the event word and the
+	 * futex wait returns immediately */
+	__atomic_fetch_add(&_queue->not_emty.waiters, 1, __ATOMIC_SEQ_CST);
+	while (1) {
+		event = __atomic_load_n(&_queue->not_emty.event, __ATOMIC_SEQ_CST);
+		ret = lib_list__dequeue(_queue, _dequeue_node, _context_id, _base);
+		if (ret != -LIB_LIST__ESTD_AGAIN) {
+			break;
+		}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+		/* The length is reserved before a node is linked, and only the producer
+		 * finding the queue empty signals. A node still in flight is waited for
+		 * without sleeping, its producer may not signal anymore */
+		if (__atomic_load_n(&_queue->length, __ATOMIC_SEQ_CST) != 0) {
+			sched_yield();
+			continue;
+		}
+#endif
+
+		if (queue_wait_event(&_queue->not_emty, event, _timeout_ms, &deadline) < LIB_LIST__EOK) {
+			break;
+		}
+	}
+	__atomic_fetch_sub(&_queue->not_emty.waiters, 1, __ATOMIC_SEQ_CST);
+
+	/* Only the transition to non-empty wakes up a waiter, pass the wake up on
+	 * if further nodes are left for the other waiters */
+	if ((ret == LIB_LIST__EOK) && (__atomic_load_n(&_queue->length, __ATOMIC_RELAXED) != 0)) {
+		queue_signal(&_queue->not_emty);
+	}
+	return ret;
+#else
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+}
+
+/* ************************************************************************//**
+ * \brief	Get first node
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_first_node[out]   pointer to first list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__get_begin(struct queue_attr *_queue, struct list_node ** _begin_node, uint32_t _context_id, void *_base)
+{
+	int ret;
+
+	if ((_queue == NULL) || (_begin_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	/*return value check at the unlock functions is not necessary, because check is already passed at the lock functions */
+	if(list_emty(&_queue->head,_base)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	*_begin_node = (struct list_node*)addr_to_phys(_base, _queue->head.prev);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Get last node
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_first_node[out]   pointer to first list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__get_end(struct queue_attr *_queue, struct list_node ** _end_node, uint32_t _context_id, void *_base)
+{
+	int ret;
+
+	if ((_queue == NULL) || (_end_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	/*return value check at the unlock functions is not necessary, because check is already passed at the lock functions */
+	if(list_emty(&_queue->head,_base)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	*_end_node = (struct list_node*)addr_to_phys(_base, _queue->head.next);
+	//*_end_node = &_queue->head;
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Get next node
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_first_node[out]   pointer to next list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__get_next(struct queue_attr *_queue, struct list_node ** _next_node, uint32_t _context_id, void *_base)
+{
+	int ret;
+	struct list_node *current_node, *next_node;
+
+	if ((_queue == NULL) || (_next_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	if(list_emty(&_queue->head,_base)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	current_node = *_next_node;
+	next_node = list_next(current_node, _base);
+
+	if(list_equal(&_queue->head, next_node)) {
+
+		//*_next_node = next_node;
+		*_next_node = list_next(next_node, _base);
+		ret = -LIB_LIST__LIST_OVERFLOW;
+	}
+	else {
+		*_next_node = next_node;
+		ret = LIB_LIST__EOK;
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return ret;
+}
+
+/* ************************************************************************//**
+ * \brief	add a new element to a selected position
+ *
+ *  \param	*_queue [in]		fifo description attribute, to dequeue
+ *	\param  *_pos_after_to_add[in]	pointer to list element after the new node is to attach
+ *	\param  *_to_add[in]		pointer to list element_to_add
+ *  \param	_context_id[in]		Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ * 			-ENOSPC			: Capacity of a bounded queue is reached
+ *
+ * ****************************************************************************/
+int lib_list__add_after(struct queue_attr *_queue, struct list_node *_pos_after_to_add, struct list_node *_to_add, uint32_t _context_id, void *_base)
+{
+	int ret, was_emty;
+
+	if ((_queue == NULL) || (_pos_after_to_add == NULL) || (_to_add == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	if (queue_is_full(_queue)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ENOSPC;
+	}
+
+	was_emty = (_queue->length == 0);
+	list_add_next(_to_add,_pos_after_to_add, _base);
+	node_owner_set(_to_add, _queue, _base);
+	queue_length_add(_queue, 1);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+
+	if (was_emty) {
+		queue_signal(&_queue->not_emty);
+	}
+	return EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	add a new element to a selected position
+ *
+ *  \param	*_queue [in]		fifo description attribute, to dequeue
+ *	\param  *_pos_before_to_add[in]	pointer to list element after the new node is to attach
+ *	\param  *_to_add[in]		pointer to list element_to_add
+ *  \param	_context_id[in]		Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ * 			-ENOSPC			: Capacity of a bounded queue is reached
+ *
+ * ****************************************************************************/
+int lib_list__add_before(struct queue_attr *_queue, struct list_node *_pos_before_to_add, struct list_node *_to_add, uint32_t _context_id, void *_base)
+{
+	int ret, was_emty;
+
+	if ((_queue == NULL) || (_pos_before_to_add == NULL) || (_to_add == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	if (queue_is_full(_queue)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ENOSPC;
+	}
+
+	was_emty = (_queue->length == 0);
+	list_add_prev(_to_add,_pos_before_to_add, _base);
+	node_owner_set(_to_add, _queue, _base);
+	queue_length_add(_queue, 1);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+
+	if (was_emty) {
+		queue_signal(&_queue->not_emty);
+	}
+	return EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Get delete node
+ *
+ *  With CONFIG_LIST__NODE_OWNER a node which is not linked to "_queue" is
+ *  rejected in constant time and the list stays untouched.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_first_node[out]   pointer to next list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty, or node is not at the queue
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__delete(struct queue_attr *_queue, struct list_node * _del, uint32_t _context_id, void *_base)
+{
+
+	int ret, was_full;
+	struct list_node *list_node;
+
+	if ((_queue == NULL) || (_del == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	if(list_emty(&_queue->head,_base)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+#ifdef CONFIG_LIST__NODE_OWNER
+	/* A node of another queue must not be unlinked */
+	if (!node_owner_is(_del, _queue, _base)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+#endif
+
+	was_full = queue_is_full(_queue);
+	list_del(_del,_base);
+	node_owner_set(_del, NULL, _base);
+	queue_length_add(_queue, -1);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+
+	if (was_full) {
+		queue_signal(&_queue->not_full);
+	}
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Check if node is at list
+ *
+ *  With CONFIG_LIST__NODE_OWNER the owner tag of the node is compared in
+ *  constant time, otherwise the list is traversed under the lock.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *	\param  **_first_node[out]   pointer to next list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return  return "1" node is in list or "0" if not, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__contains(struct queue_attr *_queue, struct list_node * _node, uint32_t _context_id, void *_base)
+{
+	int ret;
+	struct list_node *itr_node, *start, *end;
+	struct list_node *list_node;
+
+	if ((_queue == NULL) || (_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+#ifdef CONFIG_LIST__NODE_OWNER
+	/* The owner tag answers without traversing the list */
+	return node_owner_is(_node, _queue, _base);
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	list_node = (struct list_node*)addr_to_phys(_base, _queue->head.prev);
+	while(!list_equal(&_queue->head, list_node)) {
+		if(_node == list_node){
+			LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+			return 1;
+		}
+		list_node = list_next(list_node, _base);
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return 0;
+}
+
+/* ************************************************************************//**
+ * \brief	Visit all nodes within one critical section
+ *
+ *  The callback is called for every node in fifo order while the queue is
+ *  locked once, so the walk sees a consistent list. A non-zero return of the
+ *  callback stops the walk. The callback must not call a function of the
+ *  same queue.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to walk
+ *	\param  _callback[in]		 called for every node, returns non-zero to stop
+ *	\param  *_ctx[in]			 user context passed to the callback
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return number of visited nodes if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__for_each(struct queue_attr *_queue, list_visit_t _callback, void *_ctx, uint32_t _context_id, void *_base)
+{
+	int ret, count;
+	struct list_node *node, *next;
+
+	if ((_queue == NULL) || (_callback == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	count = 0;
+	node = list_next(&_queue->head, _base);
+	while (!list_equal(&_queue->head, node)) {
+		next = list_next(node, _base);
+		count++;
+		if (_callback(node, _ctx) != 0) {
+			break;
+		}
+		node = next;
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return count;
+}
+
+/* ************************************************************************//**
+ * \brief	Find the first node matching a predicate within one critical section
+ *
+ *  The predicate is called in fifo order while the queue is locked once, the
+ *  walk stops at the first node it returns non-zero for. The predicate must
+ *  not call a function of the same queue.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to search
+ *	\param  _predicate[in]		 returns non-zero for the node to find
+ *	\param  *_ctx[in]			 user context passed to the predicate
+ *	\param  **_found[out]		 pointer to the first matching list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No node matches
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__find_if(struct queue_attr *_queue, list_visit_t _predicate, void *_ctx, struct list_node **_found, uint32_t _context_id, void *_base)
+{
+	int ret;
+	struct list_node *node;
+
+	if ((_queue == NULL) || (_predicate == NULL) || (_found == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	ret = -LIB_LIST__ESTD_AGAIN;
+	node = list_next(&_queue->head, _base);
+	while (!list_equal(&_queue->head, node)) {
+		if (_predicate(node, _ctx) != 0) {
+			*_found = node;
+			ret = LIB_LIST__EOK;
+			break;
+		}
+		node = list_next(node, _base);
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return ret;
+}
+
+/* ************************************************************************//**
+ * \brief	Remove all nodes matching a predicate within one critical section
+ *
+ *  The queue is walked once while it is locked, every node the predicate
+ *  returns non-zero for is unlinked. The removed nodes are appended in fifo
+ *  order to "_removed", which can be processed with the lib_list__chain_*
+ *  functions. The predicate must not call a function of the same queue.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to remove from
+ *	\param  _predicate[in]		 returns non-zero for every node to remove
+ *	\param  *_ctx[in]			 user context passed to the predicate
+ *	\param  *_removed[out]		 head of a chain initialized by the call, or NULL to drop the nodes
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return number of removed nodes if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__remove_if(struct queue_attr *_queue, list_visit_t _predicate, void *_ctx, struct list_node *_removed, uint32_t _context_id, void *_base)
+{
+	int ret, was_full, count;
+	struct list_node *node, *next;
+
+	if ((_queue == NULL) || (_predicate == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	if (_removed != NULL) {
+		list_init(_removed, _base);
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	was_full = queue_is_full(_queue);
+	count = 0;
+	node = list_next(&_queue->head, _base);
+	while (!list_equal(&_queue->head, node)) {
+		next = list_next(node, _base);
+		if (_predicate(node, _ctx) != 0) {
+			list_del(node, _base);
+			node_owner_set(node, NULL, _base);
+			if (_removed != NULL) {
+				list_add_prev(node, _removed, _base);
+			}
+			count++;
+		}
+		node = next;
+	}
+	queue_length_add(_queue, -count);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+
+	if (was_full && (count > 0)) {
+		queue_signal(&_queue->not_full);
+	}
+	return count;
+}
+
+/* ************************************************************************//**
+ * \brief	Copy the node offsets of a queue within one short critical section
+ *
+ *  The base relative offsets of up to "_max" nodes are stored in fifo order
+ *  at "_offsets". The copy loop only follows the links, all inspection work
+ *  runs afterwards without the lock by lib_list__snapshot_next. The caller
+ *  has to ensure the nodes stay valid, e.g. by not releasing them to the
+ *  pool while a snapshot is in use.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to copy
+ *	\param  **_offsets[out]		 buffer for "_max" node offsets
+ *	\param  _max				 number of entries at "_offsets"
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return number of copied offsets if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_NOSYS		: Not supported by the lock-free queue engine
+ *
+ * ****************************************************************************/
+int lib_list__snapshot(struct queue_attr *_queue, struct list_node **_offsets, unsigned int _max, uint32_t _context_id, void *_base)
+{
+	int ret;
+	unsigned int count;
+	struct list_node *node, *virt_head;
+
+	if ((_queue == NULL) || (_offsets == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* Positional access is not supported by the lock-free queue engine */
+	return -LIB_LIST__ESTD_NOSYS;
+#endif
+
+	virt_head = (struct list_node*)addr_to_virt(_base, &_queue->head);
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	/* The stored link already is the base relative offset of the next node */
+	node = &_queue->head;
+	for (count = 0; (count < _max) && (node->prev != virt_head); count++) {
+		_offsets[count] = node->prev;
+		node = (struct list_node*)addr_to_phys(_base, node->prev);
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return (int)count;
+}
+
+/* ************************************************************************//**
+ * \brief	Iterate the nodes of a snapshot without any lock
+ *
+ *  "*_pos" has to be 0 for the first call and is advanced by every call.
+ *
+ *	\param  **_offsets[in]		 node offsets of lib_list__snapshot
+ *	\param  _count				 number of offsets returned by lib_list__snapshot
+ *	\param  *_pos[in,out]		 current position of the iteration
+ *	\param  **_node[out]		 pointer to the next list element
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_AGAIN		: All nodes of the snapshot are passed
+ *
+ * ****************************************************************************/
+int lib_list__snapshot_next(struct list_node **_offsets, unsigned int _count, unsigned int *_pos, struct list_node **_node, void *_base)
+{
+	if ((_offsets == NULL) || (_pos == NULL) || (_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (*_pos >= _count) {
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	*_node = (struct list_node*)addr_to_phys(_base, _offsets[*_pos]);
+	(*_pos)++;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Check if list is emty
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ * 
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ *
+ * ****************************************************************************/
+int lib_list__emty(struct queue_attr *_queue, uint32_t _context_id, void *_base)
+{
+	int ret;
+
+	if (_queue == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	return lf_emty(_queue, _base);
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	ret = list_emty(&_queue->head,_base);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return ret;
+}
+
+/* ************************************************************************//**
+ * \brief	Request number of queue entries
+ *
+ *  The length is maintained by all modifying operations, the call is O(1)
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to dequeue
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ *
+ * ****************************************************************************/
+int lib_list__count(struct queue_attr *_queue, uint32_t _context_id, void *_base)
+{
+	int ret;
+	unsigned int entryCount;
+
+	if (_queue == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	return (int)__atomic_load_n(&_queue->length, __ATOMIC_RELAXED);
+#endif
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	entryCount = _queue->length;
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return entryCount;
+}
+
+/* ************************************************************************//**
+ * \brief	Request number of queue entries without lock
+ *
+ *  The length maintained at the queue attribute is read by an atomic load.
+ *  The value may be outdated as soon as it is returned, it is intended
+ *  for depth monitoring.
+ *
+ *  \param	*_queue [in]		 fifo description attribute
+ *
+ *	\return number of entries if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ *
+ * ****************************************************************************/
+int lib_list__count_relaxed(struct queue_attr *_queue)
+{
+	if (_queue == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	return (int)__atomic_load_n(&_queue->length, __ATOMIC_RELAXED);
+}
+
+
+/* ************************************************************************//**
+ * \brief	Move all nodes of a queue to the end of another queue
+ *
+ *  Both queues are locked once (in address order), the chain of "_src" is
+ *  linked as a whole behind the last node of "_dst". "_src" is left empty.
+ *  With CONFIG_LIST__NODE_OWNER the owner tag of every moved node is updated.
+ *
+ *  \param	*_dst [in]			 fifo description attribute, to append the nodes
+ *  \param	*_src [in]			 fifo description attribute, to take the nodes from
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_INVAL		: "_dst" and "_src" are the same queue
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ENOSPC			: The nodes of "_src" do not fit into the bounded "_dst"
+ *
+ * ****************************************************************************/
+int lib_list__splice(struct queue_attr *_dst, struct queue_attr *_src, uint32_t _context_id, void *_base)
+{
+	int ret, was_emty, was_full;
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	struct list_node *node, *first = NULL, *last = NULL;
+	unsigned int count = 0, reserved;
+#endif
+
+	if ((_dst == NULL) || (_src == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if((_dst->initialized != M_CMP_INITIALIZED) || (_src->initialized != M_CMP_INITIALIZED)) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	if (_dst == _src) {
+		return -LIB_LIST__ESTD_INVAL;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* No atomic detach of a Michael-Scott queue, the nodes are taken one by one
+	 * and published to "_dst" as one chain. The space at "_dst" is reserved up
+	 * front for the current length of "_src" */
+	reserved = __atomic_load_n(&_src->length, __ATOMIC_RELAXED);
+	if (reserved == 0) {
+		return LIB_LIST__EOK;
+	}
+
+	ret = queue_length_reserve(_dst, reserved);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+	was_emty = (ret == 0);
+
+	while ((count < reserved) && (lf_dequeue(_src, &node, _base) == LIB_LIST__EOK)) {
+		if (last != NULL) {
+			*lf_link(last) = lf_advance(*lf_link(last), lf_offset(node, _base));
+		}
+		else {
+			first = node;
+		}
+		last = node;
+		count++;
+	}
+
+	if (count < reserved) {
+		__atomic_fetch_sub(&_dst->length, reserved - count, __ATOMIC_RELAXED);
+	}
+
+	if (first != NULL) {
+		lf_enqueue_chain(_dst, first, last, _base);
+		if (was_emty) {
+			queue_signal(&_dst->not_emty);
+		}
+	}
+	return LIB_LIST__EOK;
+#endif
+
+	ret = queue_lock_pair(_dst, _src, _context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	if ((_dst->capacity != 0) && ((_dst->length + _src->length) > _dst->capacity)) {
+		queue_unlock_pair(_dst, _src, _context_id);
+		return -LIB_LIST__ENOSPC;
+	}
+
+	was_emty = ((_dst->length == 0) && (_src->length != 0));
+	was_full = queue_is_full(_src);
+	list_owner_set(&_src->head, _dst, _base);
+	list_splice(&_src->head, &_dst->head, _base);
+	queue_length_add(_dst, _src->length);
+	queue_length_add(_src, -(int)_src->length);
+
+	queue_unlock_pair(_dst, _src, _context_id);
+
+	if (was_emty) {
+		queue_signal(&_dst->not_emty);
+	}
+	if (was_full) {
+		queue_signal(&_src->not_full);
+	}
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Detach all nodes of a queue into a private chain
+ *
+ *  The whole chain is moved to "_chain" within one critical section. The
+ *  chain is owned by the caller and can be processed with the lib_list__chain_*
+ *  functions without any lock. With lock_free the nodes are detached one by
+ *  one, at most as many as the queue held at the call; nodes enqueued
+ *  meanwhile may stay in the queue.
+ *
+ *  \param	*_queue [in]		 fifo description attribute, to take the nodes from
+ *	\param  *_chain[out]		 head of the private chain, initialized by the call
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: fifo is empty
+ *
+ * ****************************************************************************/
+int lib_list__take_all(struct queue_attr *_queue, struct list_node *_chain, uint32_t _context_id, void *_base)
+{
+	int ret, was_full;
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	struct list_node *node, *last = NULL;
+	unsigned int count;
+#endif
+
+	if ((_queue == NULL) || (_chain == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	/* The nodes are taken one by one, at most the length found at the call so
+	 * continuous producers can not keep the loop going. The chain is linked
+	 * through the tagged link words, their modification counters are kept. */
+	lf_chain_init(_chain);
+	count = __atomic_load_n(&_queue->length, __ATOMIC_RELAXED);
+	while ((count > 0) && (lf_dequeue(_queue, &node, _base) == LIB_LIST__EOK)) {
+		lf_chain_add(_chain, last, node, _base);
+		last = node;
+		count--;
+	}
+
+	if (last == NULL) {
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+	*lf_link(last) = lf_advance(*lf_link(last), M_LOCKFREE_NIL);
+	return LIB_LIST__EOK;
+#endif
+
+	list_init(_chain, _base);
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
 	}
 
 	if(list_emty(&_queue->head,_base)) {
@@ -476,319 +2635,2192 @@ int lib_list__get_next(struct queue_attr *_queue, struct list_node ** _next_node
 		return -LIB_LIST__ESTD_AGAIN;
 	}
 
-	current_node = *_next_node;
-	next_node = list_next(current_node, _base);
+	was_full = queue_is_full(_queue);
+	list_owner_set(&_queue->head, NULL, _base);
+	list_splice(&_queue->head, _chain, _base);
+	queue_length_add(_queue, -(int)_queue->length);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+
+	if (was_full) {
+		queue_signal(&_queue->not_full);
+	}
+	return LIB_LIST__EOK;
+}
+
+
+struct list_node* ITR_BEGIN(struct queue_attr *_queue, uint32_t _context_id, void *_base)
+{
+	int itr_begin_ret;
+	struct list_node *itr_begin_node;
+	itr_begin_ret = lib_list__get_begin(_queue, &itr_begin_node, _context_id, _base);
+	if (itr_begin_ret != LIB_LIST__EOK)
+		return NULL;
+	else
+		return itr_begin_node;
+}
+
+struct list_node* ITR_END(struct queue_attr *_queue, uint32_t _context_id, void *_base)
+{
+	int itr_end_ret;
+	struct list_node *itr_end_node;
+	itr_end_ret = lib_list__get_end(_queue, &itr_end_node, _context_id, _base);
+	if (itr_end_ret != LIB_LIST__EOK)
+		return NULL;
+	else
+		return itr_end_node;
+}
+
+void ITR_NEXT(struct queue_attr *_queue, struct list_node **_itr_node,  uint32_t _context_id, void *_base)
+{
+	int itr_next_ret;
+	struct list_node *itr_next_node;
+	itr_next_ret = lib_list__get_next(_queue, _itr_node, _context_id, _base);
+	if ((itr_next_ret != LIB_LIST__EOK) && (itr_next_ret != -LIB_LIST__LIST_OVERFLOW))
+		*_itr_node = NULL;
+}
+
+/* *******************************************************************
+ * Global Functions - CHAIN HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a private chain
+ *
+ *  A chain is a list head owned by a single context. It uses the same base
+ *  relative node format as the queues, but is accessed without any lock.
+ *
+ *	\param  *_chain[out]		 head of the chain
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__chain_init(struct list_node *_chain, void *_base)
+{
+	if (_chain == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	lf_chain_init(_chain);
+	return LIB_LIST__EOK;
+#endif
+
+	list_init(_chain, _base);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Take the first node of a private chain
+ *
+ *	\param  *_chain[in]			 head of the chain
+ *	\param  **_node[out]		 pointer to the detached list element
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-ESTD_AGAIN		: chain is empty
+ *
+ * ****************************************************************************/
+int lib_list__chain_dequeue(struct list_node *_chain, struct list_node **_node, void *_base)
+{
+	struct list_node *node;
+
+	if ((_chain == NULL) || (_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+#ifdef CONFIG_LIST__LOCK_TYPE_FREE
+	return lf_chain_dequeue(_chain, _node, _base);
+#endif
+
+	if (list_emty(_chain, _base)) {
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	node = (struct list_node*)addr_to_phys(_base, _chain->prev);
+	list_del(node, _base);
+	*_node = node;
+	return LIB_LIST__EOK;
+}
+
+/* *******************************************************************
+ * Global Functions - SPSC CHANNEL HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Calculation of the required channel size
+ *
+ *  The channel consists of the "struct spsc_attr" followed by "_capacity"
+ *  node slots. The returned size has to be provided at the shared segment.
+ *
+ *	\param  _capacity		 number of nodes the channel can hold (power of two)
+ *
+ *	\return "channel_size" if successful, or negative errno value on error
+ * 			-LIB_LIST__ESTD_INVAL	: Capacity is 0, not a power of two or the
+ * 									  size exceeds INT_MAX
+ *
+ * ****************************************************************************/
+int lib_list__spsc_calc_size(unsigned int _capacity)
+{
+	if ((_capacity == 0) || ((_capacity & (_capacity - 1)) != 0)) {
+		return -LIB_LIST__ESTD_INVAL;
+	}
+
+	/* The size is returned as int */
+	if (_capacity > (INT_MAX - sizeof(struct spsc_attr)) / sizeof(struct list_node*)) {
+		return -LIB_LIST__ESTD_INVAL;
+	}
+
+	return sizeof(struct spsc_attr) + _capacity * sizeof(struct list_node*);
+}
+
+/* ************************************************************************//**
+ * \brief	Initialization of a single producer / single consumer channel
+ *
+ *  \param	*_spsc [out]	channel with a size of "lib_list__spsc_calc_size"
+ *	\param  _capacity		number of nodes the channel can hold (power of two)
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__ESTD_INVAL	: Capacity is 0, not a power of two or too large
+ *
+ * ****************************************************************************/
+int lib_list__spsc_init(struct spsc_attr *_spsc, unsigned int _capacity)
+{
+	int ret;
+
+	if (_spsc == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ret = lib_list__spsc_calc_size(_capacity);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	memset((void*)_spsc, 0, ret);
+	_spsc->capacity = _capacity;
+	__atomic_store_n(&_spsc->initialized, M_CMP_INITIALIZED, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element - producer side
+ *
+ *  Wait free, must only be called by the one producing context.
+ *
+ *  \param	*_spsc [in]		channel to enqueue
+ *	\param  *_new [in]		new entry for the channel
+ *  \param	*_base[in]		base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Channel is not yet initialized
+ * 			-LIB_LIST__ENOSPC		: Channel is full
+ *
+ * ****************************************************************************/
+int lib_list__spsc_enqueue(struct spsc_attr *_spsc, struct list_node *_new, void *_base)
+{
+	uint32_t tail;
+
+	if ((_spsc == NULL) || (_new == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_spsc->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	/* Only the producer writes "tail", a relaxed load is sufficient */
+	tail = __atomic_load_n(&_spsc->tail, __ATOMIC_RELAXED);
+	if ((tail - _spsc->head_cache) == _spsc->capacity) {
+		_spsc->head_cache = __atomic_load_n(&_spsc->head, __ATOMIC_ACQUIRE);
+		if ((tail - _spsc->head_cache) == _spsc->capacity) {
+			return -LIB_LIST__ENOSPC;
+		}
+	}
+
+	_spsc->slot[tail & (_spsc->capacity - 1)] = (struct list_node*)addr_to_virt(_base, _new);
+	__atomic_store_n(&_spsc->tail, tail + 1, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element - consumer side
+ *
+ *  Wait free, must only be called by the one consuming context.
+ *
+ *  \param	*_spsc [in]				channel to dequeue
+ *	\param  **_dequeue_node[out]	pointer to dequeue a list element
+ *  \param	*_base[in]				base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Channel is not yet initialized
+ * 			-LIB_LIST__ESTD_AGAIN	: Channel is empty
+ *
+ * ****************************************************************************/
+int lib_list__spsc_dequeue(struct spsc_attr *_spsc, struct list_node **_dequeue_node, void *_base)
+{
+	uint32_t head;
+
+	if ((_spsc == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_spsc->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	/* Only the consumer writes "head", a relaxed load is sufficient */
+	head = __atomic_load_n(&_spsc->head, __ATOMIC_RELAXED);
+	if (head == _spsc->tail_cache) {
+		_spsc->tail_cache = __atomic_load_n(&_spsc->tail, __ATOMIC_ACQUIRE);
+		if (head == _spsc->tail_cache) {
+			return -LIB_LIST__ESTD_AGAIN;
+		}
+	}
+
+	*_dequeue_node = (struct list_node*)addr_to_phys(_base, _spsc->slot[head & (_spsc->capacity - 1)]);
+	__atomic_store_n(&_spsc->head, head + 1, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+
+/* *******************************************************************
+ * Global Functions - PRIORITY QUEUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a priority queue
+ *
+ *  \param	*_queue [in]		priority queue description attribute
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__prio_init(struct prio_queue_attr *_queue, void *_base)
+{
+	int ret;
+	unsigned int level;
+
+	if (_queue == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__INIT(_queue->lock);
+	if(ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	for (level = 0; level < M_LIB_LIST__PRIO_LEVELS; level++) {
+		list_init(&_queue->head[level], _base);
+	}
+	_queue->bitmap = 0;
+	_queue->length = 0;
+	_queue->initialized = M_CMP_INITIALIZED;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element at a priority level
+ *
+ *  The node is appended to the fifo of level "_prio", nodes of the same
+ *  level are dequeued in fifo order.
+ *
+ *  \param	*_queue [in]		priority queue description attribute
+ *	\param  *_new [in]			new entry for the queue
+ *	\param  _prio				priority level, 0 (lowest) up to M_LIB_LIST__PRIO_LEVELS - 1
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-EPAR_RANGE		: Priority level out of range
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__prio_enqueue(struct prio_queue_attr *_queue, struct list_node *_new, unsigned int _prio, uint32_t _context_id, void *_base)
+{
+	int ret;
+
+	if ((_queue == NULL) || (_new == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	if (_prio >= M_LIB_LIST__PRIO_LEVELS) {
+		return -LIB_LIST__EPAR_RANGE;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	list_add_prev(_new, &_queue->head[_prio], _base);
+	__atomic_store_n(&_queue->bitmap, _queue->bitmap | (1U << _prio), __ATOMIC_RELAXED);
+	__atomic_store_n(&_queue->length, _queue->length + 1, __ATOMIC_RELAXED);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Dequeue of the oldest list element of the highest non-empty level
+ *
+ *  The level is found by one count leading zeros of the non-empty bitmap.
+ *  An empty queue is reported by a read of the bitmap, without taking the lock.
+ *
+ *  \param	*_queue [in]		 priority queue description attribute
+ *	\param  **_dequeue_node[out] pointer to dequeue a list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: all levels are empty
+ *
+ * ****************************************************************************/
+int lib_list__prio_dequeue(struct prio_queue_attr *_queue, struct list_node **_dequeue_node, uint32_t _context_id, void *_base)
+{
+	int ret;
+	unsigned int level;
+	struct list_node *dequeue_node;
+
+	if ((_queue == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	if (__atomic_load_n(&_queue->bitmap, __ATOMIC_RELAXED) == 0) {
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	/* The bitmap is only changed within the critical section, read it again */
+	if (_queue->bitmap == 0) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	level = prio_highest(_queue->bitmap);
+	dequeue_node = (struct list_node*)addr_to_phys(_base, _queue->head[level].prev);
+	list_del(dequeue_node, _base);
+	if (list_emty(&_queue->head[level], _base)) {
+		__atomic_store_n(&_queue->bitmap, _queue->bitmap & ~(1U << level), __ATOMIC_RELAXED);
+	}
+	__atomic_store_n(&_queue->length, _queue->length - 1, __ATOMIC_RELAXED);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	*_dequeue_node = dequeue_node;
+	return LIB_LIST__EOK;
+}
+
+/* *******************************************************************
+ * Global Functions - SKIP LIST HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a skip list
+ *
+ *  \param	*_skip [in]			skip list description attribute
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__skip_init(struct skip_attr *_skip, void *_base)
+{
+	int ret;
+	unsigned int level;
+
+	if (_skip == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__INIT(_skip->lock);
+	if(ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	list_init(&_skip->head.node, _base);
+	for (level = 0; level < M_LIB_LIST__SKIP_LEVELS; level++) {
+		_skip->head.index[level] = (struct skip_node*)addr_to_virt(_base, &_skip->head);
+	}
+	_skip->head.key = 0;
+	_skip->head.height = M_LIB_LIST__SKIP_LEVELS;
+	_skip->height = 0;
+	_skip->seed = 0x9E3779B9U;
+	_skip->length = 0;
+	_skip->initialized = M_CMP_INITIALIZED;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Sorted insert of a node
+ *
+ *  The node is placed behind all nodes with a lower or equal key, so nodes
+ *  of the same key keep their insertion order. The position is found in
+ *  O(log n) by the index levels.
+ *
+ *  \param	*_skip [in]			skip list description attribute
+ *	\param  *_new [in]			new entry for the skip list
+ *	\param  _key				sort key of the new entry
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__skip_insert(struct skip_attr *_skip, struct skip_node *_new, uint64_t _key, uint32_t _context_id, void *_base)
+{
+	int ret;
+	uint32_t level, height;
+	struct list_node *next;
+	struct skip_node *update[M_LIB_LIST__SKIP_LEVELS];
+
+	if ((_skip == NULL) || (_new == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_skip->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_skip->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	_new->key = _key;
+	next = skip_search(_skip, _key, 1, update, _base);
+	list_add_prev(&_new->node, next, _base);
+
+	height = skip_random_height(_skip);
+	for (level = _skip->height; level < height; level++) {
+		update[level] = &_skip->head;
+	}
+	if (height > _skip->height) {
+		_skip->height = height;
+	}
+
+	_new->height = height;
+	for (level = 0; level < height; level++) {
+		_new->index[level] = update[level]->index[level];
+		update[level]->index[level] = (struct skip_node*)addr_to_virt(_base, _new);
+	}
+	__atomic_store_n(&_skip->length, _skip->length + 1, __ATOMIC_RELAXED);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_skip->lock,_context_id);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Find the first node of a key
+ *
+ *  \param	*_skip [in]			skip list description attribute
+ *	\param  _key				key to search for
+ *	\param  **_found[out]		pointer to the first node with "_key"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No node with "_key"
+ *
+ * ****************************************************************************/
+int lib_list__skip_find(struct skip_attr *_skip, uint64_t _key, struct skip_node **_found, uint32_t _context_id, void *_base)
+{
+	int ret;
+	struct list_node *node;
+	struct skip_node *update[M_LIB_LIST__SKIP_LEVELS];
+
+	if ((_skip == NULL) || (_found == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_skip->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_skip->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	node = skip_search(_skip, _key, 0, update, _base);
+	if (list_equal(node, &_skip->head.node) || (((struct skip_node*)node)->key != _key)) {
+		ret = -LIB_LIST__ESTD_AGAIN;
+	}
+	else {
+		*_found = (struct skip_node*)node;
+		ret = LIB_LIST__EOK;
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_skip->lock,_context_id);
+	return ret;
+}
+
+/* ************************************************************************//**
+ * \brief	Delete a node
+ *
+ *  The node is located in O(log n) by its key, nodes of the same key are
+ *  passed linearly.
+ *
+ *  \param	*_skip [in]			skip list description attribute
+ *	\param  *_del [in]			node to delete
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: Node is not at the skip list
+ *
+ * ****************************************************************************/
+int lib_list__skip_delete(struct skip_attr *_skip, struct skip_node *_del, uint32_t _context_id, void *_base)
+{
+	int ret;
+	uint32_t level;
+	struct list_node *node;
+	struct skip_node *pred, *update[M_LIB_LIST__SKIP_LEVELS];
+
+	if ((_skip == NULL) || (_del == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_skip->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_skip->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	/* Pass the nodes of the same key until the node to delete is reached */
+	node = skip_search(_skip, _del->key, 0, update, _base);
+	while (!list_equal(node, &_skip->head.node) && !list_equal(node, &_del->node) && (((struct skip_node*)node)->key == _del->key)) {
+		node = list_next(node, _base);
+	}
+
+	if (!list_equal(node, &_del->node)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_skip->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	for (level = 0; level < _del->height; level++) {
+		pred = update[level];
+		while (skip_index_next(pred, level, _base) != _del) {
+			pred = skip_index_next(pred, level, _base);
+		}
+		pred->index[level] = _del->index[level];
+	}
+	list_del(&_del->node, _base);
+	skip_shrink(_skip, _base);
+	__atomic_store_n(&_skip->length, _skip->length - 1, __ATOMIC_RELAXED);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_skip->lock,_context_id);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Dequeue of the node with the lowest key
+ *
+ *  \param	*_skip [in]			 skip list description attribute
+ *	\param  **_dequeue_node[out] pointer to the dequeued node
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: skip list is empty
+ *
+ * ****************************************************************************/
+int lib_list__skip_dequeue(struct skip_attr *_skip, struct skip_node **_dequeue_node, uint32_t _context_id, void *_base)
+{
+	int ret;
+	uint32_t level;
+	struct skip_node *first;
+
+	if ((_skip == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_skip->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_skip->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	if(list_emty(&_skip->head.node,_base)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_skip->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	/* The first node is directly linked by the head at all of its index levels */
+	first = (struct skip_node*)list_next(&_skip->head.node, _base);
+	for (level = 0; level < first->height; level++) {
+		_skip->head.index[level] = first->index[level];
+	}
+	list_del(&first->node, _base);
+	skip_shrink(_skip, _base);
+	__atomic_store_n(&_skip->length, _skip->length - 1, __ATOMIC_RELAXED);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_skip->lock,_context_id);
+	*_dequeue_node = first;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	In-order iteration of the bottom level
+ *
+ *  Passing NULL at "*_next_node" returns the node with the lowest key, every
+ *  further call returns the successor of the passed node.
+ *
+ *  \param	*_skip [in]			 skip list description attribute
+ *	\param  **_next_node[in,out] current node, replaced by its successor
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Skip list is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No further node
+ *
+ * ****************************************************************************/
+int lib_list__skip_get_next(struct skip_attr *_skip, struct skip_node **_next_node, uint32_t _context_id, void *_base)
+{
+	int ret;
+	struct list_node *node;
+
+	if ((_skip == NULL) || (_next_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_skip->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_skip->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	node = (*_next_node == NULL) ? &_skip->head.node : &(*_next_node)->node;
+	node = list_next(node, _base);
+	if (list_equal(node, &_skip->head.node)) {
+		ret = -LIB_LIST__ESTD_AGAIN;
+	}
+	else {
+		*_next_node = (struct skip_node*)node;
+		ret = LIB_LIST__EOK;
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_skip->lock,_context_id);
+	return ret;
+}
+
+/* *******************************************************************
+ * Global Functions - TWO LOCK QUEUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a two lock queue
+ *
+ *  \param	*_queue [in]		two lock queue description attribute, aligned to
+ *  							M_LIB_LIST__CACHE_LINE_SIZE
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__twolock_init(struct twolock_attr *_queue, void *_base)
+{
+	int ret;
+
+	if (_queue == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__INIT(_queue->head.lock);
+	if(ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__INIT(_queue->tail.lock);
+	if(ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	_queue->stub.next = _queue->stub.prev = (struct list_node*)addr_to_virt(_base, &_queue->stub);
+	_queue->head.node = _queue->tail.node = _queue->stub.next;
+	_queue->initialized = M_CMP_INITIALIZED;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element - only the tail lock is taken
+ *
+ *  \param	*_queue [in]		two lock queue description attribute
+ *	\param  *_new [in]			new entry for the queue
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__twolock_enqueue(struct twolock_attr *_queue, struct list_node *_new, uint32_t _context_id, void *_base)
+{
+	int ret;
+
+	if ((_queue == NULL) || (_new == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->tail.lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	twolock_link(_queue, _new, _base);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->tail.lock,_context_id);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element - only the head lock is taken
+ *
+ *  If the last node is dequeued, the stub is linked behind it under the tail
+ *  lock, this is the only case both locks are held (head before tail).
+ *
+ *  \param	*_queue [in]		 two lock queue description attribute
+ *	\param  **_dequeue_node[out] pointer to dequeue a list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: queue is empty
+ *
+ * ****************************************************************************/
+int lib_list__twolock_dequeue(struct twolock_attr *_queue, struct list_node **_dequeue_node, uint32_t _context_id, void *_base)
+{
+	int ret;
+	struct list_node *first, *next;
+
+	if ((_queue == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_queue->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->head.lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	first = (struct list_node*)addr_to_phys(_base, _queue->head.node);
+	next = twolock_next(first, _base);
+
+	/* Skip the stub, it is never returned */
+	if (first == &_queue->stub) {
+		if (next == first) {
+			LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->head.lock,_context_id);
+			return -LIB_LIST__ESTD_AGAIN;
+		}
+		first = next;
+		next = twolock_next(first, _base);
+	}
+
+	/* The last node can only be detached with a successor, link the stub */
+	if (next == first) {
+		ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->tail.lock,_context_id);
+		if (ret < LIB_LIST__EOK) {
+			_queue->head.node = (struct list_node*)addr_to_virt(_base, first);
+			LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->head.lock,_context_id);
+			return ret;
+		}
+		twolock_link(_queue, &_queue->stub, _base);
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->tail.lock,_context_id);
+		next = twolock_next(first, _base);
+	}
+
+	_queue->head.node = (struct list_node*)addr_to_virt(_base, next);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->head.lock,_context_id);
+	*_dequeue_node = first;
+	return LIB_LIST__EOK;
+}
+
+/* *******************************************************************
+ * Global Functions - MPSC QUEUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a multi producer / single consumer queue
+ *
+ *  \param	*_mpsc [out]	queue description attribute
+ *  \param	*_base[in]		base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__mpsc_init(struct mpsc_attr *_mpsc, void *_base)
+{
+	if (_mpsc == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	_mpsc->stub.next = _mpsc->stub.prev = (struct list_node*)addr_to_virt(_base, &_mpsc->stub);
+	_mpsc->head = _mpsc->stub.next;
+	_mpsc->tail = _mpsc->stub.next;
+	__atomic_store_n(&_mpsc->initialized, M_CMP_INITIALIZED, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element - producer side
+ *
+ *  Wait free, a single atomic exchange. Can be called by any number of
+ *  producing contexts.
+ *
+ *  \param	*_mpsc [in]		queue to enqueue
+ *	\param  *_new [in]		new entry for the queue
+ *  \param	*_base[in]		base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Queue is not yet initialized
+ *
+ * ****************************************************************************/
+int lib_list__mpsc_enqueue(struct mpsc_attr *_mpsc, struct list_node *_new, void *_base)
+{
+	if ((_mpsc == NULL) || (_new == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_mpsc->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	mpsc_push(_mpsc, _new, _base);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element - consumer side
+ *
+ *  Must only be called by the one consuming context. If a producer has
+ *  exchanged the tail but not yet linked its node, the queue is reported as
+ *  empty and the consumer has to retry.
+ *
+ *  \param	*_mpsc [in]				queue to dequeue
+ *	\param  **_dequeue_node[out]	pointer to dequeue a list element
+ *  \param	*_base[in]				base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Queue is not yet initialized
+ * 			-LIB_LIST__ESTD_AGAIN	: Queue is empty or an enqueue is in progress
+ *
+ * ****************************************************************************/
+int lib_list__mpsc_dequeue(struct mpsc_attr *_mpsc, struct list_node **_dequeue_node, void *_base)
+{
+	struct list_node *first, *next, *tail;
+
+	if ((_mpsc == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_mpsc->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	first = (struct list_node*)addr_to_phys(_base, _mpsc->head);
+	next = (struct list_node*)addr_to_phys(_base, __atomic_load_n(&first->next, __ATOMIC_ACQUIRE));
+
+	/* Skip the stub, it is never returned */
+	if (first == &_mpsc->stub) {
+		if (next == first) {
+			return -LIB_LIST__ESTD_AGAIN;
+		}
+		_mpsc->head = (struct list_node*)addr_to_virt(_base, next);
+		first = next;
+		next = (struct list_node*)addr_to_phys(_base, __atomic_load_n(&first->next, __ATOMIC_ACQUIRE));
+	}
+
+	if (next != first) {
+		_mpsc->head = (struct list_node*)addr_to_virt(_base, next);
+		*_dequeue_node = first;
+		return LIB_LIST__EOK;
+	}
+
+	/* "first" has no successor yet: either a producer is between exchange and
+	 * link, or it is the last node and the stub is pushed to detach it */
+	tail = (struct list_node*)addr_to_phys(_base, __atomic_load_n(&_mpsc->tail, __ATOMIC_ACQUIRE));
+	if (tail != first) {
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	mpsc_push(_mpsc, &_mpsc->stub, _base);
+	next = (struct list_node*)addr_to_phys(_base, __atomic_load_n(&first->next, __ATOMIC_ACQUIRE));
+	if (next == first) {
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	_mpsc->head = (struct list_node*)addr_to_virt(_base, next);
+	*_dequeue_node = first;
+	return LIB_LIST__EOK;
+}
+
+/* *******************************************************************
+ * Global Functions - SHARDED QUEUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Calculation of the required sharded queue size
+ *
+ *  The sharded queue consists of the "struct sharded_attr" followed by
+ *  "_shard_count" cache line aligned shards.
+ *
+ *	\param  _shard_count		 number of shards, usually the number of contexts
+ *
+ *	\return "sharded_size" if successful, or negative errno value on error
+ * 			-LIB_LIST__ESTD_INVAL	: Shard count is 0
+ *
+ * ****************************************************************************/
+int lib_list__sharded_calc_size(unsigned int _shard_count)
+{
+	if (_shard_count == 0) {
+		return -LIB_LIST__ESTD_INVAL;
+	}
+
+	return sizeof(struct sharded_attr) + _shard_count * sizeof(struct queue_shard);
+}
+
+/* ************************************************************************//**
+ * \brief	Initialization of a sharded queue
+ *
+ *  \param	*_sharded [out]		sharded queue with a size of "lib_list__sharded_calc_size",
+ *  							aligned to M_LIB_LIST__CACHE_LINE_SIZE
+ *	\param  _shard_count		number of shards
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__ESTD_INVAL	: Shard count is 0
+ *
+ * ****************************************************************************/
+int lib_list__sharded_init(struct sharded_attr *_sharded, unsigned int _shard_count, void *_base)
+{
+	int ret;
+	unsigned int shard;
+
+	if (_sharded == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_shard_count == 0) {
+		return -LIB_LIST__ESTD_INVAL;
+	}
+
+	for (shard = 0; shard < _shard_count; shard++) {
+		ret = lib_list__init(&_sharded->shard[shard].queue, _base);
+		if (ret < LIB_LIST__EOK) {
+			return ret;
+		}
+	}
+
+	_sharded->shard_count = _shard_count;
+	_sharded->initialized = M_CMP_INITIALIZED;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Enqueue of a list element to the local shard
+ *
+ *  The shard is selected by "_context_id" modulo the shard count, contexts
+ *  of different shards never contend.
+ *
+ *  \param	*_sharded [in]		sharded queue description attribute
+ *	\param  *_new [in]			new entry for the queue
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__sharded_enqueue(struct sharded_attr *_sharded, struct list_node *_new, uint32_t _context_id, void *_base)
+{
+	if ((_sharded == NULL) || (_new == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_sharded->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	return lib_list__enqueue(&_sharded->shard[_context_id % _sharded->shard_count].queue, _new, _context_id, _base);
+}
+
+/* ************************************************************************//**
+ * \brief	Dequeue of a list element, local shard first
+ *
+ *  If the local shard is empty, the other shards are tried round robin,
+ *  starting behind the local one. Shards with a length of 0 are passed
+ *  without taking their lock. The fifo order is only kept per shard.
+ *
+ *  \param	*_sharded [in]		 sharded queue description attribute
+ *	\param  **_dequeue_node[out] pointer to dequeue a list element
+ *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			 base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: all shards are empty
+ *
+ * ****************************************************************************/
+int lib_list__sharded_dequeue(struct sharded_attr *_sharded, struct list_node **_dequeue_node, uint32_t _context_id, void *_base)
+{
+	int ret;
+	unsigned int local, count, shard;
+	struct queue_attr *queue;
+
+	if ((_sharded == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_sharded->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	local = _context_id % _sharded->shard_count;
+	for (count = 0; count < _sharded->shard_count; count++) {
+		shard = local + count;
+		if (shard >= _sharded->shard_count) {
+			shard -= _sharded->shard_count;
+		}
+
+		queue = &_sharded->shard[shard].queue;
+		if (__atomic_load_n(&queue->length, __ATOMIC_RELAXED) == 0) {
+			continue;
+		}
+
+		ret = lib_list__dequeue(queue, _dequeue_node, _context_id, _base);
+		if (ret != -LIB_LIST__ESTD_AGAIN) {
+			return ret;
+		}
+	}
+
+	return -LIB_LIST__ESTD_AGAIN;
+}
+
+/* *******************************************************************
+ * Global Functions - WORK STEALING DEQUE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Calculation of the required deque size
+ *
+ *  The deque consists of the "struct deque_attr" followed by "_capacity"
+ *  node slots. The returned size has to be provided at the shared segment.
+ *
+ *	\param  _capacity		 number of nodes the deque can hold (power of two)
+ *
+ *	\return "deque_size" if successful, or negative errno value on error
+ * 			-LIB_LIST__ESTD_INVAL	: Capacity is 0, not a power of two or the
+ * 									  size exceeds INT_MAX
+ *
+ * ****************************************************************************/
+int lib_list__deque_calc_size(unsigned int _capacity)
+{
+	if ((_capacity == 0) || ((_capacity & (_capacity - 1)) != 0)) {
+		return -LIB_LIST__ESTD_INVAL;
+	}
+
+	/* The size is returned as int */
+	if (_capacity > (INT_MAX - sizeof(struct deque_attr)) / sizeof(struct list_node*)) {
+		return -LIB_LIST__ESTD_INVAL;
+	}
+
+	return sizeof(struct deque_attr) + _capacity * sizeof(struct list_node*);
+}
+
+/* ************************************************************************//**
+ * \brief	Initialization of a work stealing deque
+ *
+ *  \param	*_deque [out]	deque with a size of "lib_list__deque_calc_size"
+ *	\param  _capacity		number of nodes the deque can hold (power of two)
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__ESTD_INVAL	: Capacity is 0, not a power of two or too large
+ *
+ * ****************************************************************************/
+int lib_list__deque_init(struct deque_attr *_deque, unsigned int _capacity)
+{
+	int ret;
+
+	if (_deque == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ret = lib_list__deque_calc_size(_capacity);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	memset((void*)_deque, 0, ret);
+	_deque->capacity = _capacity;
+	__atomic_store_n(&_deque->initialized, M_CMP_INITIALIZED, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Push of a list element - owner side
+ *
+ *  Must only be called by the owning context, no atomic read-modify-write.
+ *
+ *  \param	*_deque [in]	deque to push to
+ *	\param  *_new [in]		new entry for the deque
+ *  \param	*_base[in]		base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Deque is not yet initialized
+ * 			-LIB_LIST__ENOSPC		: Deque is full
+ *
+ * ****************************************************************************/
+int lib_list__deque_push(struct deque_attr *_deque, struct list_node *_new, void *_base)
+{
+	int64_t bottom, top;
+
+	if ((_deque == NULL) || (_new == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_deque->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	bottom = __atomic_load_n(&_deque->bottom, __ATOMIC_RELAXED);
+	top = __atomic_load_n(&_deque->top, __ATOMIC_ACQUIRE);
+	if ((bottom - top) >= (int64_t)_deque->capacity) {
+		return -LIB_LIST__ENOSPC;
+	}
+
+	__atomic_store_n(&_deque->slot[bottom & (_deque->capacity - 1)], (struct list_node*)addr_to_virt(_base, _new), __ATOMIC_RELAXED);
+	__atomic_store_n(&_deque->bottom, bottom + 1, __ATOMIC_RELEASE);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Pop of the latest pushed list element - owner side
+ *
+ *  Must only be called by the owning context. A CAS is only required if the
+ *  last node is raced with a thief.
+ *
+ *  \param	*_deque [in]			deque to pop from
+ *	\param  **_dequeue_node[out]	pointer to the popped list element
+ *  \param	*_base[in]				base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Deque is not yet initialized
+ * 			-LIB_LIST__ESTD_AGAIN	: Deque is empty
+ *
+ * ****************************************************************************/
+int lib_list__deque_pop(struct deque_attr *_deque, struct list_node **_dequeue_node, void *_base)
+{
+	int ret;
+	int64_t bottom, top;
+	struct list_node *node;
+
+	if ((_deque == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_deque->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	/* Reserve the bottom slot before top is read, a thief reading the old
+	 * bottom afterwards is resolved by the CAS on top */
+	bottom = __atomic_load_n(&_deque->bottom, __ATOMIC_RELAXED) - 1;
+	__atomic_store_n(&_deque->bottom, bottom, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	top = __atomic_load_n(&_deque->top, __ATOMIC_RELAXED);
+
+	if (top > bottom) {
+		__atomic_store_n(&_deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	node = __atomic_load_n(&_deque->slot[bottom & (_deque->capacity - 1)], __ATOMIC_RELAXED);
+	ret = LIB_LIST__EOK;
+	if (top == bottom) {
+		/* Last node, race with the thieves */
+		if (!__atomic_compare_exchange_n(&_deque->top, &top, top + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+			ret = -LIB_LIST__ESTD_AGAIN;
+		}
+		__atomic_store_n(&_deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+	}
+
+	if (ret == LIB_LIST__EOK) {
+		*_dequeue_node = (struct list_node*)addr_to_phys(_base, node);
+	}
+	return ret;
+}
+
+/* ************************************************************************//**
+ * \brief	Steal of the oldest list element - thief side
+ *
+ *  Can be called by any context. The top is advanced by CAS, a lost race
+ *  with another thief or the owner is reported as -ESTD_BUSY.
+ *
+ *  \param	*_deque [in]			deque to steal from
+ *	\param  **_dequeue_node[out]	pointer to the stolen list element
+ *  \param	*_base[in]				base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-LIB_LIST__EPAR_NULL	: NULL pointer check
+ * 			-LIB_LIST__EEXEC_NOINIT : Deque is not yet initialized
+ * 			-LIB_LIST__ESTD_AGAIN	: Deque is empty
+ * 			-LIB_LIST__ESTD_BUSY	: Race with another context lost, retry
+ *
+ * ****************************************************************************/
+int lib_list__deque_steal(struct deque_attr *_deque, struct list_node **_dequeue_node, void *_base)
+{
+	int64_t bottom, top;
+	struct list_node *node;
+
+	if ((_deque == NULL) || (_dequeue_node == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_deque->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	top = __atomic_load_n(&_deque->top, __ATOMIC_ACQUIRE);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	bottom = __atomic_load_n(&_deque->bottom, __ATOMIC_ACQUIRE);
+	if (top >= bottom) {
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	node = __atomic_load_n(&_deque->slot[top & (_deque->capacity - 1)], __ATOMIC_RELAXED);
+	if (!__atomic_compare_exchange_n(&_deque->top, &top, top + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+		return -LIB_LIST__ESTD_BUSY;
+	}
+
+	*_dequeue_node = (struct list_node*)addr_to_phys(_base, node);
+	return LIB_LIST__EOK;
+}
+
+/* *******************************************************************
+ * Global Functions - TIMING WHEEL HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a timing wheel
+ *
+ *  \param	*_wheel [in]		timing wheel description attribute
+ *	\param  _now				current tick, the first tick processed by advance is "_now" + 1
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ *
+ * ****************************************************************************/
+int lib_list__wheel_init(struct wheel_attr *_wheel, uint64_t _now, void *_base)
+{
+	int ret;
+	unsigned int level, index;
+
+	if (_wheel == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__INIT(_wheel->lock);
+	if(ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	for (level = 0; level < M_LIB_LIST__WHEEL_LEVELS; level++) {
+		for (index = 0; index < M_LIB_LIST__WHEEL_SLOTS; index++) {
+			list_init(&_wheel->slot[level][index], _base);
+		}
+		_wheel->bitmap[level] = 0;
+	}
+	_wheel->now = _now;
+	_wheel->initialized = M_CMP_INITIALIZED;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Schedule a timer
+ *
+ *  The timer is linked to the slot of its level in O(1). A timer with an
+ *  expiry tick already processed is handed back by the next advance.
+ *
+ *  \param	*_wheel [in]		timing wheel description attribute
+ *	\param  *_timer [in]		timer to schedule, zero initialized or not pending anymore
+ *	\param  _expires			absolute expiry tick
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Wheel is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__wheel_schedule(struct wheel_attr *_wheel, struct wheel_timer *_timer, uint64_t _expires, uint32_t _context_id, void *_base)
+{
+	int ret;
+
+	if ((_wheel == NULL) || (_timer == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_wheel->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_wheel->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	_timer->expires = _expires;
+	wheel_place(_wheel, _timer, _wheel->now + 1, _base);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_wheel->lock,_context_id);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Cancel a scheduled timer
+ *
+ *  The timer is unlinked in O(1). A timer which is not pending anymore, i.e.
+ *  already cancelled or handed back by lib_list__wheel_advance, is left alone.
+ *
+ *  \param	*_wheel [in]		timing wheel description attribute
+ *	\param  *_timer [in]		timer to cancel
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Wheel is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: The timer is not pending
+ *
+ * ****************************************************************************/
+int lib_list__wheel_cancel(struct wheel_attr *_wheel, struct wheel_timer *_timer, uint32_t _context_id, void *_base)
+{
+	int ret;
+	ptrdiff_t slot;
+	struct list_node *prev, *next;
+
+	if ((_wheel == NULL) || (_timer == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_wheel->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_wheel->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	if (!_timer->pending) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_wheel->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
+	}
+
+	prev = list_priv(&_timer->node, _base);
+	next = list_next(&_timer->node, _base);
+	list_del(&_timer->node, _base);
+	list_init(&_timer->node, _base);
+	_timer->pending = 0;
+
+	/* The last timer of a slot is removed if both neighbours are the slot head */
+	if (prev == next) {
+		slot = next - &_wheel->slot[0][0];
+		if ((slot >= 0) && (slot < (ptrdiff_t)(M_LIB_LIST__WHEEL_LEVELS * M_LIB_LIST__WHEEL_SLOTS))) {
+			_wheel->bitmap[slot / M_LIB_LIST__WHEEL_SLOTS] &= ~((uint64_t)1 << (slot % M_LIB_LIST__WHEEL_SLOTS));
+		}
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_wheel->lock,_context_id);
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Advance the wheel up to a tick and take the expired timers
+ *
+ *  All ticks up to "_now" are processed, the slots of the upper levels are
+ *  cascaded when their range is reached. Ticks without work are skipped with
+ *  the slot bitmaps, the cost does not grow with the distance to "_now". The
+ *  expired timers are handed to "_expired" in expiry order, which can be
+ *  processed with the lib_list__chain_* functions.
+ *
+ *  \param	*_wheel [in]		timing wheel description attribute
+ *	\param  _now				current tick
+ *	\param  *_expired[out]		head of a chain initialized by the call
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_base[in]			base mem address
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Wheel is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No timer expired
+ *
+ * ****************************************************************************/
+int lib_list__wheel_advance(struct wheel_attr *_wheel, uint64_t _now, struct list_node *_expired, uint32_t _context_id, void *_base)
+{
+	int ret;
+	unsigned int level, index;
+	uint64_t tick;
+	struct list_node *last = NULL;
+
+	if ((_wheel == NULL) || (_expired == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_wheel->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	chain_init(_expired, _base);
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_wheel->lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	while (_wheel->now < _now) {
+		/* Nothing left to cascade or to expire, jump to the end */
+		if (wheel_emty(_wheel)) {
+			_wheel->now = _now;
+			break;
+		}
+
+		/* Ticks without a slot to expire or to cascade are skipped */
+		tick = wheel_next_tick(_wheel);
+		if (tick > _now) {
+			_wheel->now = _now;
+			break;
+		}
+		index = (unsigned int)tick & (M_LIB_LIST__WHEEL_SLOTS - 1);
+
+		/* Level 0 wrapped, cascade the upper levels as long as they wrap too */
+		if (index == 0) {
+			for (level = 1; level < M_LIB_LIST__WHEEL_LEVELS; level++) {
+				index = (unsigned int)(tick >> (M_LIB_LIST__WHEEL_SLOT_BITS * level)) & (M_LIB_LIST__WHEEL_SLOTS - 1);
+				wheel_cascade(_wheel, level, index, tick, _base);
+				if (index != 0) {
+					break;
+				}
+			}
+			index = 0;
+		}
+
+		if (_wheel->bitmap[0] & ((uint64_t)1 << index)) {
+			wheel_expire(_wheel, index, _expired, &last, _base);
+		}
+		_wheel->now = tick;
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_wheel->lock,_context_id);
+	return (last == NULL) ? -LIB_LIST__ESTD_AGAIN : LIB_LIST__EOK;
+}
+
+/* *******************************************************************
+ * Global Functions - HASH TABLE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a hash table
+ *
+ *  The bucket array is allocated from the memory region of "_hdl", all links
+ *  are relative to the base of the region. The table and its entries have to
+ *  be placed in the region too, to be shared between processes.
+ *
+ *  \param	*_hash [in]			hash table description attribute, aligned to
+ *  							M_LIB_LIST__CACHE_LINE_SIZE
+ *	\param  _bucket_count		initial number of buckets, a power of two of at least M_LIB_LIST__HASH_STRIPES
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Memory region is not yet set up
+ * 			-EPAR_RANGE		: Invalid number of buckets
+ * 			-ENOSPC			: Not enough memory for the bucket array
+ *
+ * ****************************************************************************/
+int lib_list__hash_init(struct hash_attr *_hash, uint32_t _bucket_count, uint32_t _context_id, mem_hdl_t *_hdl)
+{
+	int ret;
+	unsigned int stripe;
+	struct list_node *bucket;
+
+	if ((_hash == NULL) || (_hdl == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if (_hdl->init_state != M_MEM_REGISTERED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	if ((_bucket_count < M_LIB_LIST__HASH_STRIPES) || ((_bucket_count & (_bucket_count - 1)) != 0)) {
+		return -LIB_LIST__EPAR_RANGE;
+	}
+
+	for (stripe = 0; stripe < M_LIB_LIST__HASH_STRIPES; stripe++) {
+		ret = LIB_LIST_CRITICAL_SECTION__INIT(_hash->stripe[stripe].lock);
+		if(ret < LIB_LIST__EOK) {
+			return ret;
+		}
+		_hash->stripe[stripe].migrate_pos = 0;
+	}
+
+	bucket = hash_bucket_alloc(_bucket_count, _context_id, _hdl, &ret);
+	if (bucket == NULL) {
+		return ret;
+	}
+
+	_hash->bucket = (struct list_node*)addr_to_virt((void*)_hdl->mem_base, bucket);
+	_hash->bucket_count = _bucket_count;
+	_hash->old_bucket = NULL;
+	_hash->old_count = 0;
+	_hash->stripes_done = M_LIB_LIST__HASH_STRIPES;
+	_hash->length = 0;
+	_hash->initialized = M_CMP_INITIALIZED;
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Insert a node with a key
+ *
+ *  Only the stripe of the key is locked. Keys are not checked for uniqueness,
+ *  lib_list__hash_find returns the oldest node of a key. Above a mean of
+ *  M_LIB_LIST__HASH_LOAD_FACTOR nodes per bucket the table is doubled; the
+ *  nodes are moved to the new buckets incrementally by the following
+ *  operations of each stripe. The table is left at its size if the region
+ *  has no space for a larger bucket array.
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *	\param  *_new [in]			node to insert, placed in the memory region
+ *	\param  _key				key of the node
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ *
+ * ****************************************************************************/
+int lib_list__hash_insert(struct hash_attr *_hash, struct hash_node *_new, uint64_t _key, uint32_t _context_id, mem_hdl_t *_hdl)
+{
+	int ret;
+	uint32_t hash, bucket_count, length;
+	struct list_node *bucket;
+	void *base;
+
+	if ((_hash == NULL) || (_new == NULL) || (_hdl == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_hash->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	base = (void*)_hdl->mem_base;
+	hash = hash_key(_key);
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_hash->stripe[hash % M_LIB_LIST__HASH_STRIPES].lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
+	}
+
+	hash_migrate(_hash, hash % M_LIB_LIST__HASH_STRIPES, M_LIB_LIST__HASH_MIGRATE_STEPS, _context_id, _hdl);
+
+	bucket_count = _hash->bucket_count;
+	bucket = (struct list_node*)addr_to_phys(base, _hash->bucket);
+	_new->key = _key;
+	list_add_prev(&_new->node, &bucket[hash & (bucket_count - 1)], base);
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_hash->stripe[hash % M_LIB_LIST__HASH_STRIPES].lock,_context_id);
+
+	length = __atomic_add_fetch(&_hash->length, 1, __ATOMIC_RELAXED);
+	if ((length > (bucket_count * M_LIB_LIST__HASH_LOAD_FACTOR)) &&
+		(__atomic_load_n(&_hash->old_bucket, __ATOMIC_RELAXED) == NULL)) {
+		hash_resize(_hash, bucket_count * 2, 1, _context_id, _hdl);
+	}
+	return LIB_LIST__EOK;
+}
+
+/* ************************************************************************//**
+ * \brief	Find the oldest node of a key
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *	\param  _key				key to search for
+ *	\param  **_found[out]		pointer to the node with "_key"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
+ * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
+ * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
+ * 			-ESTD_AGAIN		: No node with "_key"
+ *
+ * ****************************************************************************/
+int lib_list__hash_find(struct hash_attr *_hash, uint64_t _key, struct hash_node **_found, uint32_t _context_id, mem_hdl_t *_hdl)
+{
+	int ret;
+	uint32_t hash, stripe, index;
+	struct list_node *bucket[2], *node;
+	void *base;
+
+	if ((_hash == NULL) || (_found == NULL) || (_hdl == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_hash->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
 
-	if(list_equal(&_queue->head, next_node)) {
+	base = (void*)_hdl->mem_base;
+	hash = hash_key(_key);
+	stripe = hash % M_LIB_LIST__HASH_STRIPES;
 
-		//*_next_node = next_node;
-		*_next_node = list_next(next_node, _base);
-		ret = -LIB_LIST__LIST_OVERFLOW;
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_hash->stripe[stripe].lock,_context_id);
+	if (ret < LIB_LIST__EOK) {
+		return ret;
 	}
-	else {
-		*_next_node = next_node;
-		ret = LIB_LIST__EOK;
+
+	hash_migrate(_hash, stripe, M_LIB_LIST__HASH_MIGRATE_STEPS, _context_id, _hdl);
+
+	/* Nodes of a not yet migrated old bucket were inserted before the nodes of the current bucket */
+	bucket[0] = __atomic_load_n(&_hash->old_bucket, __ATOMIC_RELAXED);
+	if (bucket[0] != NULL) {
+		index = hash & (_hash->old_count - 1);
+		bucket[0] = (index >= _hash->stripe[stripe].migrate_pos) ? (struct list_node*)addr_to_phys(base, bucket[0]) + index : NULL;
 	}
+	bucket[1] = (struct list_node*)addr_to_phys(base, _hash->bucket) + (hash & (_hash->bucket_count - 1));
 
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
+	ret = -LIB_LIST__ESTD_AGAIN;
+	for (index = 0; (index < 2) && (ret != LIB_LIST__EOK); index++) {
+		if (bucket[index] == NULL) {
+			continue;
+		}
+		for (node = list_next(bucket[index], base); !list_equal(node, bucket[index]); node = list_next(node, base)) {
+			if (((struct hash_node*)node)->key == _key) {
+				*_found = (struct hash_node*)node;
+				ret = LIB_LIST__EOK;
+				break;
+			}
+		}
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_hash->stripe[stripe].lock,_context_id);
 	return ret;
 }
 
 /* ************************************************************************//**
- * \brief	add a new element to a selected position
+ * \brief	Delete a node
  *
- *  \param	*_queue [in]		fifo description attribute, to dequeue
- *	\param  *_pos_after_to_add[in]	pointer to list element after the new node is to attach
- *	\param  *_to_add[in]		pointer to list element_to_add
- *  \param	_context_id[in]		Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *  \param	*_base[in]			base mem address
+ *  The node is unlinked in O(1), the caller has to ensure it is part of the
+ *  table.
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *	\param  *_del [in]			node to delete
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
  *
  *	\return EOK if successful, or negative errno value on error
  * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
  *
  * ****************************************************************************/
-int lib_list__add_after(struct queue_attr *_queue, struct list_node *_pos_after_to_add, struct list_node *_to_add, uint32_t _context_id, void *_base)
+int lib_list__hash_delete(struct hash_attr *_hash, struct hash_node *_del, uint32_t _context_id, mem_hdl_t *_hdl)
 {
 	int ret;
+	uint32_t stripe;
 
-	if ((_queue == NULL) || (_pos_after_to_add == NULL) || (_to_add == NULL)) {
+	if ((_hash == NULL) || (_del == NULL) || (_hdl == NULL)) {
 		return -LIB_LIST__EPAR_NULL;
 	}
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
+	if(_hash->initialized != M_CMP_INITIALIZED) {
 		return -LIB_LIST__EEXEC_NOINIT;
 	}
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	stripe = hash_key(_del->key) % M_LIB_LIST__HASH_STRIPES;
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_hash->stripe[stripe].lock,_context_id);
 	if (ret < LIB_LIST__EOK) {
 		return ret;
 	}
 
-	list_add_next(_to_add,_pos_after_to_add, _base);
+	hash_migrate(_hash, stripe, M_LIB_LIST__HASH_MIGRATE_STEPS, _context_id, _hdl);
+	list_del(&_del->node, (void*)_hdl->mem_base);
 
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-	return EOK;
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_hash->stripe[stripe].lock,_context_id);
+
+	__atomic_sub_fetch(&_hash->length, 1, __ATOMIC_RELAXED);
+	return LIB_LIST__EOK;
 }
 
 /* ************************************************************************//**
- * \brief	add a new element to a selected position
+ * \brief	Resize the bucket array
  *
- *  \param	*_queue [in]		fifo description attribute, to dequeue
- *	\param  *_pos_before_to_add[in]	pointer to list element after the new node is to attach
- *	\param  *_to_add[in]		pointer to list element_to_add
- *  \param	_context_id[in]		Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *  \param	*_base[in]			base mem address
+ *  The new array is allocated and swapped in while all stripes are locked
+ *  for a moment; the nodes are moved incrementally by the following
+ *  operations of each stripe. A resize still in progress is completed first.
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *	\param  _bucket_count		new number of buckets, a power of two of at least M_LIB_LIST__HASH_STRIPES
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the table
  *
  *	\return EOK if successful, or negative errno value on error
  * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
+ * 			-EPAR_RANGE		: Invalid number of buckets
+ * 			-ENOSPC			: Not enough memory for the bucket array
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
  *
  * ****************************************************************************/
-int lib_list__add_before(struct queue_attr *_queue, struct list_node *_pos_before_to_add, struct list_node *_to_add, uint32_t _context_id, void *_base)
+int lib_list__hash_resize(struct hash_attr *_hash, uint32_t _bucket_count, uint32_t _context_id, mem_hdl_t *_hdl)
+{
+	if ((_hash == NULL) || (_hdl == NULL)) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_hash->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	if ((_bucket_count < M_LIB_LIST__HASH_STRIPES) || ((_bucket_count & (_bucket_count - 1)) != 0)) {
+		return -LIB_LIST__EPAR_RANGE;
+	}
+
+	return hash_resize(_hash, _bucket_count, 0, _context_id, _hdl);
+}
+
+/* ************************************************************************//**
+ * \brief	Number of nodes of the hash table
+ *
+ *  \param	*_hash [in]			hash table description attribute
+ *
+ *	\return number of nodes, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Hash table is not yet initialized
+ *
+ * ****************************************************************************/
+int lib_list__hash_count(struct hash_attr *_hash)
+{
+	if (_hash == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
+
+	if(_hash->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
+
+	return (int)__atomic_load_n(&_hash->length, __ATOMIC_RELAXED);
+}
+
+/* *******************************************************************
+ * Global Functions - LRU CACHE HANDLING
+ * ******************************************************************/
+
+/* ************************************************************************//**
+ * \brief	Initialization of a LRU cache
+ *
+ *  The bucket array of the key index is allocated from the memory region of
+ *  "_hdl", all links are relative to the base of the region. The cache and
+ *  its entries have to be placed in the region too, to be shared between
+ *  processes.
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  _capacity			maximum number of entries
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
+ *
+ *	\return EOK if successful, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : Memory region is not yet set up
+ * 			-EPAR_RANGE		: Capacity of zero
+ * 			-ENOSPC			: Not enough memory for the bucket array
+ *
+ * ****************************************************************************/
+int lib_list__lru_init(struct lru_attr *_lru, uint32_t _capacity, uint32_t _context_id, mem_hdl_t *_hdl)
 {
 	int ret;
+	uint32_t bucket_count;
+	struct list_node *bucket;
 
-	if ((_queue == NULL) || (_pos_before_to_add == NULL) || (_to_add == NULL)) {
+	if ((_lru == NULL) || (_hdl == NULL)) {
 		return -LIB_LIST__EPAR_NULL;
 	}
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
+	if (_hdl->init_state != M_MEM_REGISTERED) {
 		return -LIB_LIST__EEXEC_NOINIT;
 	}
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
-	if (ret < LIB_LIST__EOK) {
+	if ((_capacity == 0) || (_capacity > (UINT32_C(1) << 31))) {
+		return -LIB_LIST__EPAR_RANGE;
+	}
+
+	ret = LIB_LIST_CRITICAL_SECTION__INIT(_lru->lock);
+	if(ret < LIB_LIST__EOK) {
 		return ret;
 	}
 
-	list_add_prev(_to_add,_pos_before_to_add, _base);
+	/* At most one entry per bucket in the mean */
+	bucket_count = 1;
+	while (bucket_count < _capacity) {
+		bucket_count <<= 1;
+	}
 
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-	return EOK;
+	bucket = hash_bucket_alloc(bucket_count, _context_id, _hdl, &ret);
+	if (bucket == NULL) {
+		return ret;
+	}
+
+	list_init(&_lru->recency, (void*)_hdl->mem_base);
+	_lru->bucket = (struct list_node*)addr_to_virt((void*)_hdl->mem_base, bucket);
+	_lru->bucket_count = bucket_count;
+	_lru->capacity = _capacity;
+	_lru->length = 0;
+	_lru->initialized = M_CMP_INITIALIZED;
+	return LIB_LIST__EOK;
 }
 
 /* ************************************************************************//**
- * \brief	Get delete node
+ * \brief	Look up an entry and mark it as most recently used
  *
- *  \param	*_queue [in]		 fifo description attribute, to dequeue
- *	\param  **_first_node[out]   pointer to next list element
- *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *  \param	*_base[in]			base mem address
+ *  The entry stays owned by the cache, it can be evicted by another context
+ *  as soon as the call returns.
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  _key				key to search for
+ *	\param  **_found[out]		pointer to the entry with "_key"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
  *
  *	\return EOK if successful, or negative errno value on error
  * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_AGAIN		: No entry with "_key"
  *
  * ****************************************************************************/
-int lib_list__delete(struct queue_attr *_queue, struct list_node * _del, uint32_t _context_id, void *_base)
+int lib_list__lru_get(struct lru_attr *_lru, uint64_t _key, struct lru_node **_found, uint32_t _context_id, mem_hdl_t *_hdl)
 {
-
 	int ret;
-	struct list_node *list_node;
+	struct lru_node *node;
+	void *base;
 
-	if ((_queue == NULL) || (_del == NULL)) {
+	if ((_lru == NULL) || (_found == NULL) || (_hdl == NULL)) {
 		return -LIB_LIST__EPAR_NULL;
 	}
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
+	if(_lru->initialized != M_CMP_INITIALIZED) {
 		return -LIB_LIST__EEXEC_NOINIT;
 	}
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	base = (void*)_hdl->mem_base;
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_lru->lock,_context_id);
 	if (ret < LIB_LIST__EOK) {
 		return ret;
 	}
 
-	if(list_emty(&_queue->head,_base)) {
-		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-		return -LIB_LIST__ESTD_AGAIN;
+	node = lru_search(_lru, _key, base);
+	if (node == NULL) {
+		ret = -LIB_LIST__ESTD_AGAIN;
+	}
+	else {
+		list_del(&node->recency, base);
+		list_add_prev(&node->recency, &_lru->recency, base);
+		*_found = node;
 	}
 
-	list_del(_del,_base);
-
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-	return LIB_LIST__EOK;
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_lru->lock,_context_id);
+	return ret;
 }
 
 /* ************************************************************************//**
- * \brief	Check if node is at list
+ * \brief	Insert an entry as most recently used
  *
- *  \param	*_queue [in]		 fifo description attribute, to dequeue
- *	\param  **_first_node[out]   pointer to next list element
- *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *  \param	*_base[in]			 base mem address
+ *  An entry with the same key is replaced. If the capacity is exceeded, the
+ *  least recently used entry is evicted. Replaced and evicted entries are
+ *  passed to "_evict" after the critical section is left, without a callback
+ *  they are returned to the memory region by lib_list__mem_free.
  *
- *	\return  return "1" node is in list or "0" if not, or negative errno value on error
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  *_new [in]			entry to insert, placed in the memory region
+ *	\param  _key				key of the entry
+ *	\param  _evict				eviction callback or NULL
+ *	\param  *_evict_ctx			context passed to "_evict"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
+ *
+ *	\return EOK if successful, or negative errno value on error
  * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
  *
  * ****************************************************************************/
-int lib_list__contains(struct queue_attr *_queue, struct list_node * _node, uint32_t _context_id, void *_base)
+int lib_list__lru_put(struct lru_attr *_lru, struct lru_node *_new, uint64_t _key, lru_evict_t _evict, void *_evict_ctx, uint32_t _context_id, mem_hdl_t *_hdl)
 {
 	int ret;
-	struct list_node *itr_node, *start, *end;
-	struct list_node *list_node;
+	unsigned int count = 0;
+	struct lru_node *evicted[2];
+	struct list_node *bucket;
+	void *base;
 
-	if ((_queue == NULL) || (_node == NULL)) {
+	if ((_lru == NULL) || (_new == NULL) || (_hdl == NULL)) {
 		return -LIB_LIST__EPAR_NULL;
 	}
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
+	if(_lru->initialized != M_CMP_INITIALIZED) {
 		return -LIB_LIST__EEXEC_NOINIT;
 	}
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	base = (void*)_hdl->mem_base;
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_lru->lock,_context_id);
 	if (ret < LIB_LIST__EOK) {
 		return ret;
 	}
 
-	list_node = (struct list_node*)addr_to_phys(_base, _queue->head.prev);
-	while(!list_equal(&_queue->head, list_node)) {
-		if(_node == list_node){
-			LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-			return 1;
-		}
-		list_node = list_next(list_node, _base);
+	evicted[count] = lru_search(_lru, _key, base);
+	if (evicted[count] != NULL) {
+		lru_unlink(_lru, evicted[count++], base);
 	}
 
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-	return 0;
+	bucket = (struct list_node*)addr_to_phys(base, _lru->bucket) + (hash_key(_key) & (_lru->bucket_count - 1));
+	_new->entry.key = _key;
+	list_add_prev(&_new->entry.node, bucket, base);
+	list_add_prev(&_new->recency, &_lru->recency, base);
+	__atomic_store_n(&_lru->length, _lru->length + 1, __ATOMIC_RELAXED);
+
+	if (_lru->length > _lru->capacity) {
+		evicted[count] = lru_entry(list_next(&_lru->recency, base));
+		lru_unlink(_lru, evicted[count++], base);
+	}
+
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_lru->lock,_context_id);
+
+	lru_release(evicted, count, _evict, _evict_ctx, _context_id, _hdl);
+	return LIB_LIST__EOK;
 }
 
 /* ************************************************************************//**
- * \brief	Check if list is emty
+ * \brief	Mark an entry as most recently used
+ *
+ *  The caller has to ensure the entry is still part of the cache.
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  *_node [in]			entry of the cache
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
  *
- *  \param	*_queue [in]		 fifo description attribute, to dequeue
- *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *  \param	*_base[in]			 base mem address
- * 
  *	\return EOK if successful, or negative errno value on error
  * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
  *
  * ****************************************************************************/
-int lib_list__emty(struct queue_attr *_queue, uint32_t _context_id, void *_base)
+int lib_list__lru_touch(struct lru_attr *_lru, struct lru_node *_node, uint32_t _context_id, mem_hdl_t *_hdl)
 {
 	int ret;
 
-	if (_queue == NULL) {
+	if ((_lru == NULL) || (_node == NULL) || (_hdl == NULL)) {
 		return -LIB_LIST__EPAR_NULL;
 	}
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
+	if(_lru->initialized != M_CMP_INITIALIZED) {
 		return -LIB_LIST__EEXEC_NOINIT;
 	}
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_lru->lock,_context_id);
 	if (ret < LIB_LIST__EOK) {
 		return ret;
 	}
 
-	ret = list_emty(&_queue->head,_base);
+	list_del(&_node->recency, (void*)_hdl->mem_base);
+	list_add_prev(&_node->recency, &_lru->recency, (void*)_hdl->mem_base);
 
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-	return ret;
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_lru->lock,_context_id);
+	return LIB_LIST__EOK;
 }
 
 /* ************************************************************************//**
- * \brief	Request number of queue entries
+ * \brief	Evict the least recently used entry
  *
- *  \param	*_queue [in]		 fifo description attribute, to dequeue
- *  \param	_context_id			 Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
- *  \param	*_base[in]			 base mem address
+ *  The entry is passed to "_evict" after the critical section is left,
+ *  without a callback it is returned to the memory region by
+ *  lib_list__mem_free.
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *	\param  _evict				eviction callback or NULL
+ *	\param  *_evict_ctx			context passed to "_evict"
+ *  \param	_context_id			Sequential number of contexts defined up to M_DEV_NUMBER_OF_LOCK_CONTEXT
+ *  \param	*_hdl [in]			memory region of the cache
  *
  *	\return EOK if successful, or negative errno value on error
  * 			-EPAR_NULL		: NULL pointer check
- * 			-EEXEC_NOINIT   : Queue is not yet initialized
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
  * 			-ESTD_FAULT		: The passed contexed_id exceeds the number of defined
  * 							  contexts (M_DEV_NUMBER_OF_LOCK_CONTEXT)
- * 			-ESTD_AGAIN		: fifo is empty
+ * 			-ESTD_AGAIN		: LRU cache is empty
  *
  * ****************************************************************************/
-int lib_list__count(struct queue_attr *_queue, uint32_t _context_id, void *_base)
+int lib_list__lru_evict(struct lru_attr *_lru, lru_evict_t _evict, void *_evict_ctx, uint32_t _context_id, mem_hdl_t *_hdl)
 {
 	int ret;
-	struct list_node *end, *itr;
-	unsigned int entryCount = 1;
+	struct lru_node *evicted;
+	void *base;
 
-	if (_queue == NULL) {
+	if ((_lru == NULL) || (_hdl == NULL)) {
 		return -LIB_LIST__EPAR_NULL;
 	}
 
-	if(_queue->initialized != M_CMP_INITIALIZED) {
+	if(_lru->initialized != M_CMP_INITIALIZED) {
 		return -LIB_LIST__EEXEC_NOINIT;
 	}
 
-	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_queue->lock,_context_id);
+	base = (void*)_hdl->mem_base;
+
+	ret = LIB_LIST_CRITICAL_SECTION__LOCK(_lru->lock,_context_id);
 	if (ret < LIB_LIST__EOK) {
 		return ret;
 	}
 
-	if(list_emty(&_queue->head,_base)) {
-		LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-		return 0;
-	}
-
-	// Set itr to begin and request end
-	itr = (struct list_node*)addr_to_phys(_base, _queue->head.prev);
-	end = (struct list_node*)addr_to_phys(_base, _queue->head.next);
-	while(!list_equal(itr, end)) {
-		itr = list_next(itr, _base);
-		entryCount++;
+	if (list_emty(&_lru->recency, base)) {
+		LIB_LIST_CRITICAL_SECTION__UNLOCK(_lru->lock,_context_id);
+		return -LIB_LIST__ESTD_AGAIN;
 	}
-	LIB_LIST_CRITICAL_SECTION__UNLOCK(_queue->lock,_context_id);
-	return entryCount;
-}
 
+	evicted = lru_entry(list_next(&_lru->recency, base));
+	lru_unlink(_lru, evicted, base);
 
-struct list_node* ITR_BEGIN(struct queue_attr *_queue, uint32_t _context_id, void *_base)
-{
-	int itr_begin_ret;
-	struct list_node *itr_begin_node;
-	itr_begin_ret = lib_list__get_begin(_queue, &itr_begin_node, _context_id, _base);
-	if (itr_begin_ret != LIB_LIST__EOK)
-		return NULL;
-	else
-		return itr_begin_node;
-}
+	LIB_LIST_CRITICAL_SECTION__UNLOCK(_lru->lock,_context_id);
 
-struct list_node* ITR_END(struct queue_attr *_queue, uint32_t _context_id, void *_base)
-{
-	int itr_end_ret;
-	struct list_node *itr_end_node;
-	itr_end_ret = lib_list__get_end(_queue, &itr_end_node, _context_id, _base);
-	if (itr_end_ret != LIB_LIST__EOK)
-		return NULL;
-	else
-		return itr_end_node;
+	lru_release(&evicted, 1, _evict, _evict_ctx, _context_id, _hdl);
+	return LIB_LIST__EOK;
 }
 
-void ITR_NEXT(struct queue_attr *_queue, struct list_node **_itr_node,  uint32_t _context_id, void *_base)
+/* ************************************************************************//**
+ * \brief	Number of entries of the LRU cache
+ *
+ *  \param	*_lru [in]			LRU cache description attribute
+ *
+ *	\return number of entries, or negative errno value on error
+ * 			-EPAR_NULL		: NULL pointer check
+ * 			-EEXEC_NOINIT   : LRU cache is not yet initialized
+ *
+ * ****************************************************************************/
+int lib_list__lru_count(struct lru_attr *_lru)
 {
-	int itr_next_ret;
-	struct list_node *itr_next_node;
-	itr_next_ret = lib_list__get_next(_queue, _itr_node, _context_id, _base);
-	if ((itr_next_ret != LIB_LIST__EOK) && (itr_next_ret != -LIB_LIST__LIST_OVERFLOW))
-		*_itr_node = NULL;
-}
+	if (_lru == NULL) {
+		return -LIB_LIST__EPAR_NULL;
+	}
 
+	if(_lru->initialized != M_CMP_INITIALIZED) {
+		return -LIB_LIST__EEXEC_NOINIT;
+	}
 
+	return (int)__atomic_load_n(&_lru->length, __ATOMIC_RELAXED);
+}
 
 /* *******************************************************************
  * Global Functions - MEMORY HANDLING